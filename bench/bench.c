@@ -0,0 +1,173 @@
+//*****************************************************************************
+//
+//  Reporter of the kernel benchmarks.
+//  File: 		bench.c
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//  The reporter is the highest priority task. It sleeps for BENCH_PERIOD_MS,
+//  reads g_bench_ops and the cycle counter, and prints one key=value line 
+//  per run, e.g.
+//
+//    bench=yield run=1 ops=1234567 cycles=80000123 ops_per_s=1234565
+//
+//  followed by the average of all the runs (with the interrupt cycles per 
+//  second, if the benchmark measures them) and the kernel latencies 
+//  (OS_CFG_HIST, OS_CFG_IRQ_OFF_TRACK), after which the program ends.
+//
+//*****************************************************************************
+//*****************************************************************************
+//
+//  The following are header files for the C standard library.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+//*****************************************************************************
+//
+//  This is the application header file.
+//
+//*****************************************************************************
+
+#include "os.h"
+#include "dwt.h"
+#include "console.h"
+#include "report.h"
+#include "bench.h"
+
+//*****************************************************************************
+//
+//  The following are global definitions for the benchmark.
+//
+//*****************************************************************************
+
+volatile uint32_t g_bench_ops;			// completed operations
+volatile uint32_t g_bench_irq_cycles;	// cycles taken by the interrupts
+static const char *gp_name;				// name of the benchmark
+
+//*****************************************************************************
+//
+//  Functions for the internal use.
+//
+//*****************************************************************************
+//*****************************************************************************
+//
+//! @brief Compute an operation rate.
+//!
+//! @param[in] ops Number of operations.
+//! @param[in] cycles Core clock cycles elapsed.
+//!
+//! @return Operations per second.
+//
+//*****************************************************************************
+static uint32_t rate(uint64_t ops, uint64_t cycles)
+{
+	return cycles ? (uint32_t)(ops * CPU_CLOCK_FREQ / cycles) : 0;
+}
+
+//*****************************************************************************
+//
+//! @brief Reporter task.
+//!
+//! This task prints the operation rate of every run and the average of all 
+//! the runs, then ends the program.
+//!
+//! @return None.
+//
+//*****************************************************************************
+static void report_task(void)
+{
+	uint32_t run, ops, cycles, last_ops, last_stamp, now, first_irq_cycles;
+	uint64_t total_ops = 0, total_cycles = 0;
+	char line[128];
+
+	first_irq_cycles = g_bench_irq_cycles;
+	last_ops = g_bench_ops;
+	last_stamp = DWT_get_cycles();
+	for (run = 1; run <= BENCH_RUNS; run++)
+	{
+		OS_sleep(BENCH_PERIOD_MS);
+
+		now = DWT_get_cycles();
+		ops = g_bench_ops - last_ops;
+		cycles = now - last_stamp;
+		last_ops += ops;
+		last_stamp = now;
+		total_ops += ops;
+		total_cycles += cycles;
+
+		snprintf(line, sizeof(line), "bench=%s run=%lu ops=%lu cycles=%lu "
+			"ops_per_s=%lu\n", gp_name, (unsigned long)run, 
+			(unsigned long)ops, (unsigned long)cycles, 
+			(unsigned long)rate(ops, cycles));
+		Console_write(line);
+	}
+
+	snprintf(line, sizeof(line), "bench=%s runs=%lu ops_per_s=%lu\n", gp_name,
+		(unsigned long)BENCH_RUNS, (unsigned long)rate(total_ops, 
+		total_cycles));
+	if(g_bench_irq_cycles != first_irq_cycles)
+	{
+		// e.g. "bench=tick runs=3 ops_per_s=123 irq_cycles_per_s=456"
+		snprintf(&line[strlen(line) - 1], sizeof(line) - strlen(line) + 1,
+			" irq_cycles_per_s=%lu\n", (unsigned long)rate(
+			g_bench_irq_cycles - first_irq_cycles, total_cycles));
+	}
+	Console_write(line);
+	// kernel latencies under this load (if enabled)
+	Report_kernel_hist();
+	Report_irq_off();
+	Console_exit(0);
+}
+
+//*****************************************************************************
+//
+//  Functions for the API.
+//
+//*****************************************************************************
+//*****************************************************************************
+//
+//! @brief Start a benchmark.
+//!
+//! This function adds the reporter task and starts the kernel. The tasks 
+//! under test must have been added before, with priorities from 
+//! BENCH_PRIORITY down.
+//!
+//! @param[in] p_name Name of the benchmark (bench=<name> in the reports).
+//!
+//! @return None (never returns).
+//
+//*****************************************************************************
+void Bench_start(const char *p_name)
+{
+	gp_name = p_name;
+	if(OS_add_task(&report_task, 0) < 0)
+	{
+		Bench_error("no_tcb_for_reporter");
+	}
+	// the reporter needs the cycle counter even if the kernel does not
+	DWT_init();
+	OS_start();
+}
+
+//*****************************************************************************
+//
+//! @brief Report a failed check and end the program.
+//!
+//! @param[in] p_msg Description of the failure (a single word).
+//!
+//! @return None (never returns).
+//
+//*****************************************************************************
+void Bench_error(const char *p_msg)
+{
+	char line[96];
+
+	snprintf(line, sizeof(line), "bench=%s error=%s\n", gp_name, p_msg);
+	Console_write(line);
+	Console_exit(1);
+}
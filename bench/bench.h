@@ -0,0 +1,62 @@
+//*****************************************************************************
+//
+//  Prototypes for the kernel benchmarks.
+//  File: 		bench.h
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//  Every benchmark (bench_xxx.c) is a separate application, modelled on the
+//  Thread-Metric suite. Its tasks count the completed operations in 
+//  g_bench_ops, and the reporter task of bench.c prints the rate.
+//
+//*****************************************************************************
+
+#ifndef __BENCH_H__
+#define __BENCH_H__
+
+//*****************************************************************************
+//
+//  The following are defines for the benchmark runs. Each can be overridden
+//  from the compiler command line.
+//
+//*****************************************************************************
+
+#ifndef BENCH_PERIOD_MS
+#define BENCH_PERIOD_MS 	1000		// length of a run (ms)
+#endif
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS 			3			// number of runs before the summary
+#endif
+
+#define BENCH_PRIORITY 		1			// highest priority of the tasks 
+										// under test (0 is the reporter)
+
+//*****************************************************************************
+//
+//  The following is the counter of the completed operations.
+//
+//*****************************************************************************
+
+extern volatile uint32_t g_bench_ops;
+
+//*****************************************************************************
+//
+//  The following is the counter of the cycles taken by the interrupts from
+//  the tasks under test, for the benchmarks that measure it (bench_tick.c).
+//
+//*****************************************************************************
+
+extern volatile uint32_t g_bench_irq_cycles;
+
+//*****************************************************************************
+//
+//	Prototypes for the API
+//
+//*****************************************************************************
+
+extern void Bench_start(const char *p_name);
+extern void Bench_error(const char *p_msg);
+
+#endif	// __BENCH_H__
@@ -0,0 +1,50 @@
+//*****************************************************************************
+//
+//  Message processing benchmark.
+//  File: 		bench_fifo.c
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//  A task sends a message through the fifo and gets it back. Each operation
+//  is one OS_Fifo_put() and OS_Fifo_get() pair.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include "os.h"
+#include "bench.h"
+
+//*****************************************************************************
+//
+//! task_fifo sends a sequence number and checks that it comes back.
+//
+//*****************************************************************************
+void task_fifo(void)
+{
+	uint32_t seq = 0;
+
+	while(1)
+	{
+		if(OS_Fifo_put(seq) != 0)
+		{
+			Bench_error("fifo_full");
+		}
+		if(OS_Fifo_get() != seq)
+		{
+			Bench_error("fifo_data");
+		}
+		seq++;
+		g_bench_ops++;
+	}
+}
+
+int main(void)
+{
+	OS_Fifo_init();
+	OS_add_task(&task_fifo, BENCH_PRIORITY);
+	Bench_start("fifo");
+
+	// this never executes
+	return 0;
+}
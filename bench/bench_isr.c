@@ -0,0 +1,56 @@
+//*****************************************************************************
+//
+//  Interrupt processing benchmark.
+//  File: 		bench_isr.c
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//  A task raises the software interrupt, whose handler signals a semaphore 
+//  that the task then takes. Each operation is one ISR-to-task signal.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include "os.h"
+#include "swi.h"
+#include "bench.h"
+
+int32_t sema_isr;
+
+//*****************************************************************************
+//
+//! ISR of the software interrupt, signals the task.
+//
+//*****************************************************************************
+void isr_post(void)
+{
+	OS_Semaphore_post(&sema_isr);
+}
+
+//*****************************************************************************
+//
+//! task_isr triggers the interrupt and waits for its signal.
+//
+//*****************************************************************************
+void task_isr(void)
+{
+	while(1)
+	{
+		SWI_trigger();
+		OS_Semaphore_pend(&sema_isr);
+		g_bench_ops++;
+	}
+}
+
+int main(void)
+{
+	OS_Semaphore_init(&sema_isr, 0);
+	// between the kernel event timer (0) and the SysTick (7)
+	SWI_init(&isr_post, 1);
+	OS_add_task(&task_isr, BENCH_PRIORITY);
+	Bench_start("isr");
+
+	// this never executes
+	return 0;
+}
@@ -0,0 +1,141 @@
+//*****************************************************************************
+//
+//  Memory pool benchmark.
+//  File: 		bench_pool.c
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//  The kernel has no dynamic memory, so the pool is the fixed-size block 
+//  allocator an application would build on top of it: a free list guarded
+//  by a critical section. Two tasks of the same priority allocate, write 
+//  and free a block. One operation in a hundred holds its block over a 
+//  yield, so the tasks also switch with blocks taken. Each operation is one
+//  allocation and one release.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stddef.h>
+#include "os.h"
+#include "cpu.h"
+#include "bench.h"
+
+#define POOL_BLOCKS 		8			// number of blocks
+#define POOL_BLOCK_SIZE 	128			// bytes per block (as Thread-Metric)
+
+//*****************************************************************************
+//
+//  This data structure defines a block of the pool. The link to the next 
+//  free block is kept in the block itself.
+//
+//*****************************************************************************
+
+union block
+{
+	union block *next;
+	uint8_t data[POOL_BLOCK_SIZE];
+};
+
+static union block g_blocks[POOL_BLOCKS];
+static union block *gp_free;			// first free block
+
+//*****************************************************************************
+//
+//! @brief Initialize the pool.
+//
+//*****************************************************************************
+static void pool_init(void)
+{
+	uint8_t i;
+
+	for (i = 0; i < POOL_BLOCKS - 1; i++)
+	{
+		g_blocks[i].next = &g_blocks[i + 1];
+	}
+	g_blocks[POOL_BLOCKS - 1].next = NULL;
+	gp_free = &g_blocks[0];
+}
+
+//*****************************************************************************
+//
+//! @brief Allocate a block.
+//!
+//! @return Pointer to the block, NULL if the pool is empty.
+//
+//*****************************************************************************
+static void *pool_alloc(void)
+{
+	union block *p_block;
+
+	CPU_disable_irq();
+	p_block = gp_free;
+	if(p_block != NULL)
+	{
+		gp_free = p_block->next;
+	}
+	CPU_enable_irq();
+
+	return p_block;
+}
+
+//*****************************************************************************
+//
+//! @brief Release a block.
+//!
+//! @param[in] p_mem Pointer to a block returned by pool_alloc().
+//
+//*****************************************************************************
+static void pool_free(void *p_mem)
+{
+	union block *p_block = p_mem;
+
+	CPU_disable_irq();
+	p_block->next = gp_free;
+	gp_free = p_block;
+	CPU_enable_irq();
+}
+
+//*****************************************************************************
+//
+//! task_pool allocates a block, writes it and gives it back. Every 
+//! hundredth block is held over a yield, so both tasks churn the free list.
+//! The counter is shared by both tasks, and a time slice may end in the 
+//! middle of the increment, so it is done with interrupts disabled.
+//
+//*****************************************************************************
+void task_pool(void)
+{
+	uint8_t *p_data;
+	uint32_t ops = 0;
+
+	while(1)
+	{
+		p_data = pool_alloc();
+		if(p_data == NULL)
+		{
+			Bench_error("pool_empty");
+		}
+		p_data[0] = (uint8_t)ops;
+		if((ops % 100) == 0)
+		{
+			OS_suspend();
+		}
+		pool_free(p_data);
+		ops++;
+		CPU_disable_irq();
+		g_bench_ops++;
+		CPU_enable_irq();
+	}
+}
+
+int main(void)
+{
+	pool_init();
+	OS_add_task(&task_pool, BENCH_PRIORITY);
+	OS_add_task(&task_pool, BENCH_PRIORITY);
+	Bench_start("pool");
+
+	// this never executes
+	return 0;
+}
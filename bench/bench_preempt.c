@@ -0,0 +1,109 @@
+//*****************************************************************************
+//
+//  Preemptive scheduling benchmark.
+//  File: 		bench_preempt.c
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//  Five tasks of decreasing priority form a chain: the lowest priority task
+//  signals the next one up, which preempts it and signals the next one, and
+//  so on up to the highest. Then the chain unwinds as each task blocks 
+//  again. Each operation is one task released by a lower priority task.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include "os.h"
+#include "bench.h"
+
+#define NUM_CHAIN_TASKS 	5
+
+int32_t sema_chain[NUM_CHAIN_TASKS - 1];
+
+//*****************************************************************************
+//
+//! Release the next task up the chain. Unless OS_CFG_POST_PREEMPT is set, a
+//! post does not run the scheduler, so the poster yields to let the released
+//! task preempt it right away.
+//
+//*****************************************************************************
+static void release(uint8_t idx)
+{
+	OS_Semaphore_post(&sema_chain[idx]);
+#if !OS_CFG_POST_PREEMPT
+	OS_suspend();
+#endif
+}
+
+//*****************************************************************************
+//
+//! task_0 (highest priority) to task_3 wait for the task below, task_4 
+//! (lowest priority) starts the chain over and over.
+//
+//*****************************************************************************
+void task_0(void)
+{
+	while(1)
+	{
+		OS_Semaphore_pend(&sema_chain[0]);
+		g_bench_ops++;
+	}
+}
+
+void task_1(void)
+{
+	while(1)
+	{
+		OS_Semaphore_pend(&sema_chain[1]);
+		g_bench_ops++;
+		release(0);
+	}
+}
+
+void task_2(void)
+{
+	while(1)
+	{
+		OS_Semaphore_pend(&sema_chain[2]);
+		g_bench_ops++;
+		release(1);
+	}
+}
+
+void task_3(void)
+{
+	while(1)
+	{
+		OS_Semaphore_pend(&sema_chain[3]);
+		g_bench_ops++;
+		release(2);
+	}
+}
+
+void task_4(void)
+{
+	while(1)
+	{
+		release(3);
+	}
+}
+
+int main(void)
+{
+	uint8_t i;
+
+	for (i = 0; i < NUM_CHAIN_TASKS - 1; i++)
+	{
+		OS_Semaphore_init(&sema_chain[i], 0);
+	}
+	OS_add_task(&task_0, BENCH_PRIORITY);
+	OS_add_task(&task_1, BENCH_PRIORITY + 1);
+	OS_add_task(&task_2, BENCH_PRIORITY + 2);
+	OS_add_task(&task_3, BENCH_PRIORITY + 3);
+	OS_add_task(&task_4, BENCH_PRIORITY + 4);
+	Bench_start("preempt");
+
+	// this never executes
+	return 0;
+}
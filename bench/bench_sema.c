@@ -0,0 +1,59 @@
+//*****************************************************************************
+//
+//  Semaphore ping-pong benchmark.
+//  File: 		bench_sema.c
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//  Two tasks hand the control to each other through a pair of semaphores. 
+//  Each operation is one round trip (two posts, two blocking pends).
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include "os.h"
+#include "bench.h"
+
+int32_t sema_ping, sema_pong;
+
+//*****************************************************************************
+//
+//! task_ping signals task_pong and waits for its answer.
+//
+//*****************************************************************************
+void task_ping(void)
+{
+	while(1)
+	{
+		OS_Semaphore_post(&sema_pong);
+		OS_Semaphore_pend(&sema_ping);
+		g_bench_ops++;
+	}
+}
+
+//*****************************************************************************
+//
+//! task_pong answers every signal of task_ping.
+//
+//*****************************************************************************
+void task_pong(void)
+{
+	while(1)
+	{
+		OS_Semaphore_pend(&sema_pong);
+		OS_Semaphore_post(&sema_ping);
+	}
+}
+
+int main(void)
+{
+	OS_Semaphore_init(&sema_ping, 0);
+	OS_Semaphore_init(&sema_pong, 0);
+	OS_add_task(&task_ping, BENCH_PRIORITY);
+	OS_add_task(&task_pong, BENCH_PRIORITY + 1);
+	Bench_start("sema");
+
+	// this never executes
+	return 0;
+}
@@ -0,0 +1,84 @@
+//*****************************************************************************
+//
+//  Tick overhead benchmark.
+//  File: 		bench_tick.c
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//  A background task spins reading the cycle counter, while two periodic
+//  tasks of higher priority sleep most of the time, as in a typical idle
+//  system. Every gap between two reads longer than TICK_GAP_CYCLES is time
+//  taken by the interrupts (tick ISRs, scheduler and context switches),
+//  which is added to g_bench_irq_cycles. Build it with OS_CFG_TICK_UNIFIED
+//  at 0 and 1, and OS_CFG_TICK_FREQ at 1000 and 10000, to compare the tick
+//  overhead per second.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include "os.h"
+#include "dwt.h"
+#include "bench.h"
+
+#ifndef TICK_GAP_CYCLES
+#define TICK_GAP_CYCLES 	100			// longest loop without an interrupt
+#endif
+
+//*****************************************************************************
+//
+//! Background task, counts the loops and the cycles taken from it.
+//
+//*****************************************************************************
+void task_spin(void)
+{
+	uint32_t prev, now;
+
+	prev = DWT_get_cycles();
+	while(1)
+	{
+		now = DWT_get_cycles();
+		if(now - prev > TICK_GAP_CYCLES)
+		{
+			g_bench_irq_cycles += now - prev;
+		}
+		prev = now;
+		g_bench_ops++;
+	}
+}
+
+//*****************************************************************************
+//
+//! Periodic tasks, they wake up and go back to sleep.
+//
+//*****************************************************************************
+void task_period_10(void)
+{
+	uint32_t last_wake = OS_time_ms();
+
+	while(1)
+	{
+		OS_sleep_until(&last_wake, 10);
+	}
+}
+
+void task_period_25(void)
+{
+	uint32_t last_wake = OS_time_ms();
+
+	while(1)
+	{
+		OS_sleep_until(&last_wake, 25);
+	}
+}
+
+int main(void)
+{
+	OS_add_task(&task_period_10, BENCH_PRIORITY);
+	OS_add_task(&task_period_25, BENCH_PRIORITY);
+	OS_add_task(&task_spin, BENCH_PRIORITY + 1);
+	Bench_start("tick");
+
+	// this never executes
+	return 0;
+}
@@ -0,0 +1,51 @@
+//*****************************************************************************
+//
+//  Cooperative scheduling benchmark.
+//  File: 		bench_yield.c
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//  Five tasks of the same priority give up the CPU with OS_suspend() after 
+//  every increment, so each operation is one cooperative context switch.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include "os.h"
+#include "cpu.h"
+#include "bench.h"
+
+#define NUM_YIELD_TASKS 	5
+
+//*****************************************************************************
+//
+//! Every task counts one operation and yields to the next one (round robin).
+//! The tasks share the counter and a time slice may end in the middle of 
+//! the increment, so it is done with interrupts disabled.
+//
+//*****************************************************************************
+void task_yield(void)
+{
+	while(1)
+	{
+		CPU_disable_irq();
+		g_bench_ops++;
+		CPU_enable_irq();
+		OS_suspend();
+	}
+}
+
+int main(void)
+{
+	uint8_t i;
+
+	for (i = 0; i < NUM_YIELD_TASKS; i++)
+	{
+		OS_add_task(&task_yield, BENCH_PRIORITY);
+	}
+	Bench_start("yield");
+
+	// this never executes
+	return 0;
+}
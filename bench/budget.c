@@ -0,0 +1,241 @@
+//*****************************************************************************
+//
+//  CPU budget measurement.
+//  File: 		budget.c
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//  task_hog never blocks, above task_worker, which needs WORK_MS of CPU in
+//  every WORK_PERIOD_MS. Both count the cycles they run with the cycle
+//  counter (a gap longer than GAP_CYCLES between two reads is time taken
+//  by others). The controller task limits the hog to BUDGET_MS every
+//  BUDGET_PERIOD_MS, and prints the CPU share of both tasks after
+//  PHASE_MS of each action:
+//
+//    budget=suspend hog_pct=27 worker_pct=49
+//    budget=demote hog_pct=46 worker_pct=49
+//    budget=none hog_pct=97 worker_pct=0
+//
+//  Suspended, the hog gets its budget back in every period and nothing
+//  more. Demoted, it also takes the idle time. Without a budget the worker
+//  starves. A share off the expected one by more than a tick per period
+//  ends the program with a failure. Requires OS_CFG_BUDGET. With OS_CFG_EDF
+//  only the suspend action is checked.
+//
+//*****************************************************************************
+//*****************************************************************************
+//
+//  The following are header files for the C standard library.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+//*****************************************************************************
+//
+//  This is the application header file.
+//
+//*****************************************************************************
+
+#include "os.h"
+#include "dwt.h"
+#include "console.h"
+
+#if !OS_CFG_BUDGET
+#error "budget.c requires OS_CFG_BUDGET=1 (RTOS_BUDGET)"
+#endif
+
+//*****************************************************************************
+//
+//  The following are defines for the measurement. Each can be overridden
+//  from the compiler command line.
+//
+//*****************************************************************************
+
+#ifndef PHASE_MS
+#define PHASE_MS 			1000		// length of each action (ms)
+#endif
+
+#ifndef GAP_CYCLES
+#define GAP_CYCLES 			100			// longest loop without a preemption
+#endif
+
+#define BUDGET_MS 			3			// CPU time of the hog per period
+#define BUDGET_PERIOD_MS 	10
+#define WORK_MS 			5			// CPU time of the worker per period
+#define WORK_PERIOD_MS 		10
+
+// error allowed on a share: one tick per budget period (1 ms tick)
+#define TOLERANCE_PCT 		(100 / BUDGET_PERIOD_MS)
+
+#define CYCLES_PER_MS 		(CPU_CLOCK_FREQ / 1000)
+
+//*****************************************************************************
+//
+//  The following are global definitions for the measurement.
+//
+//*****************************************************************************
+
+static volatile uint32_t g_hog_cycles;		// cycles run by task_hog
+static volatile uint32_t g_work_cycles;		// cycles run by task_worker
+static int32_t g_hog_id;
+static bool g_failed;
+
+//*****************************************************************************
+//
+//! @brief Spin until the caller has run a number of cycles.
+//!
+//! @param[in] p_cycles Counter of the cycles run by the caller.
+//! @param[in] cycles Cycles to run (0 spins forever).
+//!
+//! @return None.
+//
+//*****************************************************************************
+static void spin(volatile uint32_t *p_cycles, uint32_t cycles)
+{
+	uint32_t prev, now, run = 0;
+
+	prev = DWT_get_cycles();
+	while((cycles == 0) || (run < cycles))
+	{
+		now = DWT_get_cycles();
+		if(now - prev <= GAP_CYCLES)
+		{
+			*p_cycles += now - prev;
+			run += now - prev;
+		}
+		prev = now;
+	}
+}
+
+//*****************************************************************************
+//
+//! @brief Run one action and print the shares.
+//!
+//! @param[in] p_name Name of the action.
+//! @param[in] budget Budget of the hog (ms, 0 for none).
+//! @param[in] action OS_BUDGET_SUSPEND or OS_BUDGET_DEMOTE.
+//! @param[out] p_hog_pct CPU share of the hog (%).
+//! @param[out] p_work_pct CPU share of the worker (%).
+//!
+//! @return None.
+//
+//*****************************************************************************
+static void phase(const char *p_name, uint32_t budget, uint8_t action,
+	uint32_t *p_hog_pct, uint32_t *p_work_pct)
+{
+	uint32_t hog, work, start, elapsed;
+	char line[96];
+
+	OS_set_task_budget((uint8_t)g_hog_id, budget, BUDGET_PERIOD_MS, action);
+	hog = g_hog_cycles;
+	work = g_work_cycles;
+	start = DWT_get_cycles();
+	OS_sleep(PHASE_MS);
+	elapsed = DWT_get_cycles() - start;
+
+	*p_hog_pct = (uint32_t)((uint64_t)(g_hog_cycles - hog) * 100 / elapsed);
+	*p_work_pct = (uint32_t)((uint64_t)(g_work_cycles - work) * 100 /
+		elapsed);
+	snprintf(line, sizeof(line), "budget=%s hog_pct=%lu worker_pct=%lu\n",
+		p_name, (unsigned long)*p_hog_pct, (unsigned long)*p_work_pct);
+	Console_write(line);
+}
+
+//*****************************************************************************
+//
+//! @brief Check a share.
+//!
+//! @param[in] p_what Name of the share.
+//! @param[in] pct Measured share (%).
+//! @param[in] min Lowest share expected (%).
+//! @param[in] max Highest share expected (%).
+//!
+//! @return None.
+//
+//*****************************************************************************
+static void check(const char *p_what, uint32_t pct, uint32_t min,
+	uint32_t max)
+{
+	char line[96];
+
+	if((pct < min) || (pct > max))
+	{
+		snprintf(line, sizeof(line), "budget=error %s=%lu expected=%lu-%lu\n",
+			p_what, (unsigned long)pct, (unsigned long)min,
+			(unsigned long)max);
+		Console_write(line);
+		g_failed = true;
+	}
+}
+
+//*****************************************************************************
+//
+//! task_control runs the actions in turn, then ends the program.
+//
+//*****************************************************************************
+void task_control(void)
+{
+	const uint32_t budget_pct = 100 * BUDGET_MS / BUDGET_PERIOD_MS;
+	const uint32_t work_pct = 100 * WORK_MS / WORK_PERIOD_MS;
+	uint32_t hog, work;
+
+	// held to its budget, replenished in every period
+	phase("suspend", BUDGET_MS, OS_BUDGET_SUSPEND, &hog, &work);
+	check("suspend_hog_pct", hog, budget_pct - TOLERANCE_PCT,
+		budget_pct + TOLERANCE_PCT);
+	check("suspend_worker_pct", work, work_pct - TOLERANCE_PCT, 100);
+
+#if !OS_CFG_EDF
+	// its budget, and the idle time at the lowest priority
+	phase("demote", BUDGET_MS, OS_BUDGET_DEMOTE, &hog, &work);
+	check("demote_hog_pct", hog, 100 - work_pct - TOLERANCE_PCT,
+		100 - work_pct + TOLERANCE_PCT);
+	check("demote_worker_pct", work, work_pct - TOLERANCE_PCT, 100);
+#endif
+
+	// no limit, the worker starves (by priority)
+	phase("none", 0, OS_BUDGET_SUSPEND, &hog, &work);
+#if !OS_CFG_EDF
+	check("none_worker_pct", work, 0, TOLERANCE_PCT);
+#endif
+
+	Console_exit(g_failed ? 1 : 0);
+}
+
+//*****************************************************************************
+//
+//! task_hog never blocks, task_worker needs WORK_MS every WORK_PERIOD_MS.
+//
+//*****************************************************************************
+void task_hog(void)
+{
+	spin(&g_hog_cycles, 0);
+}
+
+void task_worker(void)
+{
+	uint32_t last_wake = OS_time_ms();
+
+	while(1)
+	{
+		spin(&g_work_cycles, WORK_MS * CYCLES_PER_MS);
+		OS_sleep_until(&last_wake, WORK_PERIOD_MS);
+	}
+}
+
+int main(void)
+{
+	OS_add_task(&task_control, 0);
+	g_hog_id = OS_add_task(&task_hog, 1);
+	OS_add_task(&task_worker, 2);
+	// the measurement needs the cycle counter even if the kernel does not
+	DWT_init();
+	OS_start();
+
+	// this never executes
+	return 0;
+}
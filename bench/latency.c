@@ -0,0 +1,184 @@
+//*****************************************************************************
+//
+//  Interrupt-to-task latency measurement.
+//  File: 		latency.c
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//  The Timer1A raises the software interrupt (swi.h) every LAT_PERIOD_US, 
+//  a period that drifts over the 1 ms kernel tick so that every phase is 
+//  sampled. The ISR stamps the event with the cycle counter and posts a
+//  semaphore; the handler task stamps its first instruction after the pend.
+//  The difference goes into a histogram (hist.h), while tasks like task_F of
+//  "main.c" keep the CPU busy. After LAT_SAMPLES events the results are 
+//  printed (in core clock cycles):
+//
+//    latency=isr_to_task preempt=1 prio=high overruns=0 clock_hz=80000000
+//    hist=isr_to_task count=2000 min=73 mean=270 p50=239 p90=415 p99=735 
+//        p999=1215 max=1750
+//
+//  LAT_HIGH_PRIORITY selects whether the handler task is above the load 
+//  (prio=high) or shares its priority (prio=shared); the kernel option 
+//  OS_CFG_POST_PREEMPT selects whether the post preempts the load.
+//
+//*****************************************************************************
+//*****************************************************************************
+//
+//  The following are header files for the C standard library.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+//*****************************************************************************
+//
+//  This is the application header file.
+//
+//*****************************************************************************
+
+#include "os.h"
+#include "dwt.h"
+#include "swi.h"
+#include "console.h"
+#include "hist.h"
+#include "report.h"
+
+//*****************************************************************************
+//
+//  The following are defines for the measurement. Each can be overridden 
+//  from the compiler command line.
+//
+//*****************************************************************************
+
+#ifndef LAT_HIGH_PRIORITY
+#define LAT_HIGH_PRIORITY 	1			// 1 if the handler task is above the
+										// load, 0 if it shares its priority
+#endif
+
+#ifndef LAT_PERIOD_US
+#define LAT_PERIOD_US 		997			// period of the events (us)
+#endif
+
+#ifndef LAT_SAMPLES
+#define LAT_SAMPLES 		2000		// events measured before the report
+#endif
+
+#define LOAD_PRIORITY 		2
+#define HANDLER_PRIORITY 	(LAT_HIGH_PRIORITY ? 1 : LOAD_PRIORITY)
+
+//*****************************************************************************
+//
+//  The following are global definitions for the measurement.
+//
+//*****************************************************************************
+
+int32_t sema_event;						// signaled by the ISR
+static volatile uint32_t g_stamp;		// cycle count of the last event
+static volatile bool g_armed;			// true if the handler waits
+static volatile uint32_t g_overruns;	// events lost (handler still busy)
+
+static struct hist g_hist = HIST_INITIALIZER;
+
+int32_t cnt_load, cnt_F;
+
+//*****************************************************************************
+//
+//! @brief Print the results.
+//!
+//! @return None.
+//
+//*****************************************************************************
+static void report(void)
+{
+	char line[128];
+
+	snprintf(line, sizeof(line), "latency=isr_to_task preempt=%d prio=%s "
+		"overruns=%lu clock_hz=%lu\n", OS_CFG_POST_PREEMPT, 
+		LAT_HIGH_PRIORITY ? "high" : "shared", (unsigned long)g_overruns, 
+		(unsigned long)CPU_CLOCK_FREQ);
+	Console_write(line);
+	Report_hist("isr_to_task", &g_hist);
+}
+
+//*****************************************************************************
+//
+//! ISR of the event, stamps it and signals the handler task.
+//
+//*****************************************************************************
+void isr_event(void)
+{
+	if(!g_armed)
+	{
+		g_overruns++;
+		return;
+	}
+	g_armed = false;
+	g_stamp = DWT_get_cycles();
+	OS_Semaphore_post(&sema_event);
+}
+
+//*****************************************************************************
+//
+//! task_handler measures the time from the ISR to its first instruction.
+//
+//*****************************************************************************
+void task_handler(void)
+{
+	uint32_t i, now;
+
+	g_armed = true;
+	SWI_start_timer(LAT_PERIOD_US * (CPU_CLOCK_FREQ / 1000000));
+	for (i = 0; i < LAT_SAMPLES; i++)
+	{
+		OS_Semaphore_pend(&sema_event);
+		now = DWT_get_cycles();
+		Hist_record(&g_hist, now - g_stamp);
+		g_armed = true;
+	}
+
+	report();
+	Console_exit(0);
+}
+
+//*****************************************************************************
+//
+//! task_load uses the kernel (fifo and semaphore critical sections) and 
+//! task_F spins, as in "main.c".
+//
+//*****************************************************************************
+void task_load(void)
+{
+	while(1)
+	{
+		OS_Fifo_put(cnt_load);
+		cnt_load = OS_Fifo_get() + 1;
+	}
+}
+
+void task_F(void)
+{
+	while(1)
+	{
+		cnt_F++;
+	}
+}
+
+int main(void)
+{
+	OS_Fifo_init();
+	OS_Semaphore_init(&sema_event, 0);
+	// between the kernel event timer (0) and the SysTick (7)
+	SWI_init(&isr_event, 1);
+	OS_add_task(&task_handler, HANDLER_PRIORITY);
+	OS_add_task(&task_load, LOAD_PRIORITY);
+	OS_add_task(&task_F, LOAD_PRIORITY);
+	// the measurement needs the cycle counter even if the kernel does not
+	DWT_init();
+	OS_start();
+
+	// this never executes
+	return 0;
+}
@@ -0,0 +1,199 @@
+//*****************************************************************************
+//
+//  Nested run-to-completion task check.
+//  File: 		rtc.c
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//  Two run-to-completion tasks share the stack. job_low is activated by the
+//  control task every LOW_PERIOD_MS and runs for LOW_RUN_MS, and job_high
+//  is activated by a periodic event every HIGH_PERIOD_MS, so the tick starts
+//  it on top of job_low while the context switch still runs on the stack of
+//  job_low. Each job fills a local pattern, and checks it once it is done
+//  (job_low after being preempted). After RUN_MS the counts are printed:
+//
+//    rtc=nested low=50 high=249 nested=50 errors=0
+//
+//  A wrong pattern, a job that runs nested in the wrong order or no nested
+//  activation at all ends the program with a failure; a frame built over
+//  the live stack of the context switch crashes it. Requires OS_CFG_RTC.
+//
+//*****************************************************************************
+//*****************************************************************************
+//
+//  The following are header files for the C standard library.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdio.h>
+
+//*****************************************************************************
+//
+//  This is the application header file.
+//
+//*****************************************************************************
+
+#include "os.h"
+#include "console.h"
+
+#if !OS_CFG_RTC
+#error "rtc.c requires OS_CFG_RTC=1 (RTOS_RTC)"
+#endif
+
+//*****************************************************************************
+//
+//  The following are defines for the check.
+//
+//*****************************************************************************
+
+#define RUN_MS 				500			// time the jobs run
+#define LOW_PERIOD_MS 		10			// activations of job_low
+#define LOW_RUN_MS 			3			// time job_low runs
+#define HIGH_PERIOD_MS 		2			// activations of job_high
+
+#define PATTERN_SIZE 		8			// words of the local patterns
+
+//*****************************************************************************
+//
+//  The following are global definitions for the check.
+//
+//*****************************************************************************
+
+static int32_t sema_low, sema_high;
+static volatile uint32_t g_low_cnt, g_high_cnt, g_nested_cnt, g_errors;
+static volatile uint32_t g_depth;		// jobs started and not done
+
+//*****************************************************************************
+//
+//! @brief Fill a pattern on the stack of the caller.
+//!
+//! @param[out] p_pattern Pattern to fill.
+//! @param[in] seed First word of the pattern.
+//!
+//! @return None.
+//
+//*****************************************************************************
+static void fill(volatile uint32_t *p_pattern, uint32_t seed)
+{
+	uint32_t i;
+
+	for (i = 0; i < PATTERN_SIZE; i++)
+	{
+		p_pattern[i] = seed + i;
+	}
+}
+
+//*****************************************************************************
+//
+//! @brief Check a pattern filled by fill().
+//!
+//! @param[in] p_pattern Pattern to check.
+//! @param[in] seed First word of the pattern.
+//!
+//! @return None.
+//
+//*****************************************************************************
+static void check(const volatile uint32_t *p_pattern, uint32_t seed)
+{
+	uint32_t i;
+
+	for (i = 0; i < PATTERN_SIZE; i++)
+	{
+		if(p_pattern[i] != seed + i)
+		{
+			g_errors++;
+			return;
+		}
+	}
+}
+
+//*****************************************************************************
+//
+//! job_low runs for LOW_RUN_MS, preempted by job_high.
+//
+//*****************************************************************************
+static void job_low(void)
+{
+	volatile uint32_t pattern[PATTERN_SIZE];
+	uint32_t seed = 0x10000000 + g_low_cnt, start;
+
+	if(g_depth != 0)
+	{
+		g_errors++;						// nested on a higher job
+	}
+	g_depth++;
+	fill(pattern, seed);
+	start = OS_time_ms();
+	while(OS_time_ms() - start < LOW_RUN_MS)
+	{
+	}
+	check(pattern, seed);
+	g_low_cnt++;
+	g_depth--;
+}
+
+//*****************************************************************************
+//
+//! job_high counts the times it runs nested on job_low.
+//
+//*****************************************************************************
+static void job_high(void)
+{
+	volatile uint32_t pattern[PATTERN_SIZE];
+	uint32_t seed = 0x20000000 + g_high_cnt;
+
+	if(g_depth > 1)
+	{
+		g_errors++;
+	}
+	else if(g_depth == 1)
+	{
+		g_nested_cnt++;
+	}
+	g_depth++;
+	fill(pattern, seed);
+	check(pattern, seed);
+	g_high_cnt++;
+	g_depth--;
+}
+
+//*****************************************************************************
+//
+//! task_control activates job_low, then prints and checks the counts.
+//
+//*****************************************************************************
+void task_control(void)
+{
+	uint32_t i;
+	char line[96];
+
+	for (i = 0; i < RUN_MS / LOW_PERIOD_MS; i++)
+	{
+		OS_Semaphore_post(&sema_low);
+		OS_sleep(LOW_PERIOD_MS);
+	}
+
+	snprintf(line, sizeof(line), "rtc=nested low=%lu high=%lu nested=%lu "
+		"errors=%lu\n", (unsigned long)g_low_cnt, (unsigned long)g_high_cnt,
+		(unsigned long)g_nested_cnt, (unsigned long)g_errors);
+	Console_write(line);
+	Console_exit(((g_errors == 0) && (g_nested_cnt != 0) &&
+		(g_low_cnt + 1 >= RUN_MS / LOW_PERIOD_MS)) ? 0 : 1);
+}
+
+int main(void)
+{
+	OS_Semaphore_init(&sema_low, 0);
+	OS_Semaphore_init(&sema_high, 0);
+	// the first task runs at OS_start, so it has a stack of its own
+	OS_add_task(&task_control, 0);
+	OS_add_rtc_task(&job_high, 1, &sema_high);
+	OS_add_rtc_task(&job_low, 2, &sema_low);
+	OS_add_periodic_event(&sema_high, HIGH_PERIOD_MS);
+	OS_start();
+
+	// this never executes
+	return 0;
+}
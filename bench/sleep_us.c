@@ -0,0 +1,161 @@
+//*****************************************************************************
+//
+//  High-resolution sleep wake error measurement.
+//  File: 		sleep_us.c
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//  The sleeper task calls OS_sleep_us() with 50, 100, 150 and 200 us in
+//  turn, and measures the time it was away with the cycle counter. The
+//  time past the request is the wake error, which goes into a histogram
+//  (hist.h), while tasks like task_F of "main.c" keep the CPU busy. The
+//  requests are not a multiple of the tick, so the wakes land at every
+//  phase of it. After SLEEP_SAMPLES sleeps the results are printed (in core
+//  clock cycles):
+//
+//    sleep_us=wake_error early=0 clock_hz=80000000
+//    hist=wake_error count=2000 min=352 mean=536 p50=415 p90=575 p99=1727
+//        p999=16383 max=66584
+//
+//  A sleep that returns more than 1 us before its request (OS_time_us()
+//  truncates to the microsecond) is counted as early, and ends the program
+//  with a failure. Requires OS_CFG_HRTIMER.
+//
+//*****************************************************************************
+//*****************************************************************************
+//
+//  The following are header files for the C standard library.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdio.h>
+
+//*****************************************************************************
+//
+//  This is the application header file.
+//
+//*****************************************************************************
+
+#include "os.h"
+#include "dwt.h"
+#include "console.h"
+#include "hist.h"
+#include "report.h"
+
+#if !OS_CFG_HRTIMER
+#error "sleep_us.c requires OS_CFG_HRTIMER=1 (RTOS_HRTIMER)"
+#endif
+
+//*****************************************************************************
+//
+//  The following are defines for the measurement. Each can be overridden
+//  from the compiler command line.
+//
+//*****************************************************************************
+
+#ifndef SLEEP_SAMPLES
+#define SLEEP_SAMPLES 		2000		// sleeps measured before the report
+#endif
+
+#define SLEEP_MIN_US 		50			// shortest request (us)
+#define SLEEP_STEP_US 		50			// step between the requests (us)
+#define SLEEP_STEPS 		4			// requests of 50, 100, 150, 200 us
+
+#define CYCLES_PER_US 		(CPU_CLOCK_FREQ / 1000000)
+
+//*****************************************************************************
+//
+//  The following are global definitions for the measurement.
+//
+//*****************************************************************************
+
+static uint32_t g_early;				// sleeps that returned too soon
+
+static struct hist g_hist = HIST_INITIALIZER;
+
+int32_t cnt_load, cnt_F;
+
+//*****************************************************************************
+//
+//! @brief Print the results.
+//!
+//! @return None.
+//
+//*****************************************************************************
+static void report(void)
+{
+	char line[128];
+
+	snprintf(line, sizeof(line), "sleep_us=wake_error early=%lu "
+		"clock_hz=%lu\n", (unsigned long)g_early,
+		(unsigned long)CPU_CLOCK_FREQ);
+	Console_write(line);
+	Report_hist("wake_error", &g_hist);
+}
+
+//*****************************************************************************
+//
+//! task_sleeper measures the time past every request.
+//
+//*****************************************************************************
+void task_sleeper(void)
+{
+	uint32_t i, request, start, elapsed;
+
+	for (i = 0; i < SLEEP_SAMPLES; i++)
+	{
+		request = (SLEEP_MIN_US + (i % SLEEP_STEPS) * SLEEP_STEP_US) *
+			CYCLES_PER_US;
+		start = DWT_get_cycles();
+		OS_sleep_us(request / CYCLES_PER_US);
+		elapsed = DWT_get_cycles() - start;
+
+		if(elapsed + CYCLES_PER_US < request)
+		{
+			g_early++;
+		}
+		Hist_record(&g_hist, elapsed > request ? elapsed - request : 0);
+	}
+
+	report();
+	Console_exit(g_early ? 1 : 0);
+}
+
+//*****************************************************************************
+//
+//! task_load uses the kernel (fifo and semaphore critical sections) and
+//! task_F spins, as in "main.c".
+//
+//*****************************************************************************
+void task_load(void)
+{
+	while(1)
+	{
+		OS_Fifo_put(cnt_load);
+		cnt_load = OS_Fifo_get() + 1;
+	}
+}
+
+void task_F(void)
+{
+	while(1)
+	{
+		cnt_F++;
+	}
+}
+
+int main(void)
+{
+	OS_Fifo_init();
+	OS_add_task(&task_sleeper, 1);
+	OS_add_task(&task_load, 2);
+	OS_add_task(&task_F, 2);
+	// the measurement needs the cycle counter even if the kernel does not
+	DWT_init();
+	OS_start();
+
+	// this never executes
+	return 0;
+}
@@ -0,0 +1,210 @@
+//*****************************************************************************
+//
+//  Preemption threshold measurement.
+//  File: 		threshold.c
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//  The tasks of "main.c", with each consumer one priority above its
+//  producer, so that with OS_CFG_POST_PREEMPT every post or put preempts
+//  the producer. After THR_RUN_MS the context switches of all the tasks
+//  (preemptions and yields, see OS_get_task_stats) are printed:
+//
+//    threshold=off preempt=1 switches=1144 preemptions=500 yields=644
+//    threshold=on preempt=1 switches=684 preemptions=200 yields=484
+//
+//  THR_ENABLED selects whether each producer and consumer pair shares a
+//  threshold, the priority of the consumer (threshold=on), so that they
+//  run to completion with respect to each other, or runs without one
+//  (threshold=off). Requires OS_CFG_TASK_STATS and the fixed priority
+//  scheduler (EDF ignores the thresholds).
+//
+//*****************************************************************************
+//*****************************************************************************
+//
+//  The following are header files for the C standard library.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdio.h>
+
+//*****************************************************************************
+//
+//  This is the application header file.
+//
+//*****************************************************************************
+
+#include "os.h"
+#include "console.h"
+
+#if !OS_CFG_TASK_STATS
+#error "threshold.c requires OS_CFG_TASK_STATS=1 (RTOS_TASK_STATS)"
+#endif
+
+//*****************************************************************************
+//
+//  The following are defines for the measurement. Each can be overridden
+//  from the compiler command line.
+//
+//*****************************************************************************
+
+#ifndef THR_ENABLED
+#define THR_ENABLED 		1			// 1 to give the pairs a threshold
+#endif
+
+#ifndef THR_RUN_MS
+#define THR_RUN_MS 			2000		// time measured (ms)
+#endif
+
+#define PRIORITY_A 			0
+#define PRIORITY_C 			1			// consumer above its producer B
+#define PRIORITY_B 			2
+#define PRIORITY_E 			3			// consumer above its producer D
+#define PRIORITY_D 			4
+#define PRIORITY_F 			5
+
+//*****************************************************************************
+//
+//  The following are global definitions for the measurement.
+//
+//*****************************************************************************
+
+int32_t sema_A, sema_BC;
+int32_t cnt_A, cnt_B, cnt_C, cnt_D, cnt_E, cnt_F;
+
+//*****************************************************************************
+//
+//! task_report waits THR_RUN_MS, prints the switches and ends the program.
+//
+//*****************************************************************************
+void task_report(void)
+{
+	struct os_task_stats stats[OS_CFG_NUM_TASKS];
+	uint32_t preemptions = 0, yields = 0;
+	uint8_t i, cnt;
+	char line[128];
+
+	cnt = OS_get_task_stats(stats, OS_CFG_NUM_TASKS);
+	for (i = 0; i < cnt; i++)
+	{
+		preemptions -= stats[i].preemptions;
+		yields -= stats[i].yields;
+	}
+	OS_sleep(THR_RUN_MS);
+	cnt = OS_get_task_stats(stats, OS_CFG_NUM_TASKS);
+	for (i = 0; i < cnt; i++)
+	{
+		preemptions += stats[i].preemptions;
+		yields += stats[i].yields;
+	}
+
+	snprintf(line, sizeof(line), "threshold=%s preempt=%d switches=%lu "
+		"preemptions=%lu yields=%lu\n", THR_ENABLED ? "on" : "off",
+		OS_CFG_POST_PREEMPT, (unsigned long)(preemptions + yields),
+		(unsigned long)preemptions, (unsigned long)yields);
+	Console_write(line);
+	Console_exit(0);
+}
+
+//*****************************************************************************
+//
+//! The workload of "main.c": task_A runs on a periodic event, task_B posts
+//! to task_C every 20 ms, task_D puts 5 items for task_E every 50 ms, and
+//! task_F spins.
+//
+//*****************************************************************************
+void task_A(void)
+{
+	while(1)
+	{
+		OS_Semaphore_pend(&sema_A);
+		cnt_A++;
+	}
+}
+
+void task_B(void)
+{
+	uint32_t last_wake = OS_time_ms();
+
+	while(1)
+	{
+		cnt_B++;
+		OS_Semaphore_post(&sema_BC);
+		OS_sleep_until(&last_wake, 20);
+	}
+}
+
+void task_C(void)
+{
+	while(1)
+	{
+		OS_Semaphore_pend(&sema_BC);
+		cnt_C = cnt_B;
+	}
+}
+
+void task_D(void)
+{
+	uint8_t i;
+
+	while(1)
+	{
+		for (i = 0; i < 5; i++)
+		{
+			OS_Fifo_put(++cnt_D);
+		}
+		OS_sleep(50);
+	}
+}
+
+void task_E(void)
+{
+	while(1)
+	{
+		cnt_E = OS_Fifo_get();
+	}
+}
+
+void task_F(void)
+{
+	while(1)
+	{
+		cnt_F++;
+	}
+}
+
+int main(void)
+{
+	int32_t id_B, id_C, id_D, id_E;
+
+	OS_Fifo_init();
+	OS_Semaphore_init(&sema_A, 0);
+	OS_Semaphore_init(&sema_BC, 0);
+	OS_add_task(&task_report, PRIORITY_A);
+	OS_add_task(&task_A, PRIORITY_A);
+	id_B = OS_add_task(&task_B, PRIORITY_B);
+	id_C = OS_add_task(&task_C, PRIORITY_C);
+	id_D = OS_add_task(&task_D, PRIORITY_D);
+	id_E = OS_add_task(&task_E, PRIORITY_E);
+	OS_add_task(&task_F, PRIORITY_F);
+	OS_add_periodic_event(&sema_A, 10);
+#if THR_ENABLED
+	// each pair runs to completion with respect to each other
+	OS_set_task_threshold((uint8_t)id_B, PRIORITY_C);
+	OS_set_task_threshold((uint8_t)id_C, PRIORITY_C);
+	OS_set_task_threshold((uint8_t)id_D, PRIORITY_E);
+	OS_set_task_threshold((uint8_t)id_E, PRIORITY_E);
+#else
+	(void)id_B;
+	(void)id_C;
+	(void)id_D;
+	(void)id_E;
+#endif
+
+	OS_start();
+
+	// this never executes
+	return 0;
+}
@@ -0,0 +1,220 @@
+//*****************************************************************************
+//
+//  Software timer check.
+//  File: 		timers.c
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//  Three timers run for RUN_MS while every TCB of the kernel is taken by a
+//  task, so the callbacks only run if the timer service task has a TCB of
+//  its own:
+//
+//    - a one-shot of ONE_SHOT_MS, which must expire once, on time;
+//    - an auto-reload timer of RELOAD_MS, which must expire once per period;
+//    - a one-shot restarted by its own callback RESTART_CNT times, every
+//      RESTART_MS.
+//
+//  The results are printed, e.g.
+//
+//    timers=one_shot count=1 at_ms=25
+//    timers=auto_reload count=50 expected=50
+//    timers=restart count=20 min_gap_ms=7 max_gap_ms=8
+//    timers=tasks added=8
+//
+//  A timer off by more than a tick ends the program with a failure. The
+//  stacks are given with OS_add_task_stack(), so it also runs with
+//  OS_CFG_NUM_STACKS=0. Requires OS_CFG_TIMER.
+//
+//*****************************************************************************
+//*****************************************************************************
+//
+//  The following are header files for the C standard library.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+//*****************************************************************************
+//
+//  This is the application header file.
+//
+//*****************************************************************************
+
+#include "os.h"
+#include "console.h"
+
+#if !OS_CFG_TIMER
+#error "timers.c requires OS_CFG_TIMER=1 (RTOS_TIMER)"
+#endif
+
+//*****************************************************************************
+//
+//  The following are defines for the check.
+//
+//*****************************************************************************
+
+#define RUN_MS 				500			// time the timers run
+#define ONE_SHOT_MS 		25
+#define RELOAD_MS 			10
+#define RESTART_MS 			7
+#define RESTART_CNT 		20
+#define TOLERANCE_MS 		1			// one tick (1 kHz)
+
+#define CHECK_STACK_SIZE 	256			// words of the checker stack
+#define IDLER_STACK_SIZE 	64			// words of the stack of the others
+
+//*****************************************************************************
+//
+//  The following are global definitions for the check.
+//
+//*****************************************************************************
+
+static struct os_timer g_one_shot, g_reload, g_restart;
+static volatile uint32_t g_one_shot_cnt, g_one_shot_ms;
+static volatile uint32_t g_reload_cnt;
+static volatile uint32_t g_restart_cnt, g_restart_last;
+static volatile uint32_t g_restart_min = UINT32_MAX, g_restart_max;
+static uint32_t g_start_ms;
+static uint32_t g_task_cnt;
+static bool g_failed;
+
+static int32_t sema_never;				// never posted
+
+static uint32_t g_check_stack[CHECK_STACK_SIZE]
+	__attribute__((aligned(8)));
+static uint32_t g_idler_stacks[OS_CFG_NUM_TASKS][IDLER_STACK_SIZE]
+	__attribute__((aligned(8)));
+
+//*****************************************************************************
+//
+//! Callbacks, run by the timer service task.
+//
+//*****************************************************************************
+static void one_shot_expired(void *p_arg)
+{
+	(void)p_arg;
+	g_one_shot_ms = OS_time_ms() - g_start_ms;
+	g_one_shot_cnt++;
+}
+
+static void reload_expired(void *p_arg)
+{
+	(void)p_arg;
+	g_reload_cnt++;
+}
+
+static void restart_expired(void *p_arg)
+{
+	uint32_t now = OS_time_ms(), gap = now - g_restart_last;
+
+	g_restart_min = gap < g_restart_min ? gap : g_restart_min;
+	g_restart_max = gap > g_restart_max ? gap : g_restart_max;
+	g_restart_last = now;
+	if(++g_restart_cnt < RESTART_CNT)
+	{
+		OS_Timer_start((struct os_timer *)p_arg, RESTART_MS, 0);
+	}
+}
+
+//*****************************************************************************
+//
+//! @brief Check a result.
+//!
+//! @param[in] p_line Line to print.
+//! @param[in] ok false if the result is wrong.
+//!
+//! @return None.
+//
+//*****************************************************************************
+static void check(const char *p_line, bool ok)
+{
+	Console_write(p_line);
+	if(!ok)
+	{
+		Console_write("timers=error\n");
+		g_failed = true;
+	}
+}
+
+//*****************************************************************************
+//
+//! task_check starts the timers, waits RUN_MS and checks the expiries.
+//
+//*****************************************************************************
+void task_check(void)
+{
+	char line[96];
+
+	OS_Timer_init(&g_one_shot, one_shot_expired, 0);
+	OS_Timer_init(&g_reload, reload_expired, 0);
+	OS_Timer_init(&g_restart, restart_expired, &g_restart);
+	g_start_ms = OS_time_ms();
+	g_restart_last = g_start_ms;
+	OS_Timer_start(&g_one_shot, ONE_SHOT_MS, 0);
+	OS_Timer_start(&g_reload, RELOAD_MS, RELOAD_MS);
+	OS_Timer_start(&g_restart, RESTART_MS, 0);
+	OS_sleep(RUN_MS);
+	OS_Timer_stop(&g_reload);
+
+	snprintf(line, sizeof(line), "timers=one_shot count=%lu at_ms=%lu\n",
+		(unsigned long)g_one_shot_cnt, (unsigned long)g_one_shot_ms);
+	check(line, (g_one_shot_cnt == 1) && (g_one_shot_ms >= ONE_SHOT_MS) &&
+		(g_one_shot_ms <= ONE_SHOT_MS + TOLERANCE_MS));
+
+	snprintf(line, sizeof(line), "timers=auto_reload count=%lu "
+		"expected=%lu\n", (unsigned long)g_reload_cnt,
+		(unsigned long)(RUN_MS / RELOAD_MS));
+	check(line, (g_reload_cnt + 1 >= RUN_MS / RELOAD_MS) &&
+		(g_reload_cnt <= RUN_MS / RELOAD_MS));
+
+	snprintf(line, sizeof(line), "timers=restart count=%lu min_gap_ms=%lu "
+		"max_gap_ms=%lu\n", (unsigned long)g_restart_cnt,
+		(unsigned long)g_restart_min, (unsigned long)g_restart_max);
+	check(line, (g_restart_cnt == RESTART_CNT) &&
+		(g_restart_min >= RESTART_MS) &&
+		(g_restart_max <= RESTART_MS + TOLERANCE_MS));
+
+	snprintf(line, sizeof(line), "timers=tasks added=%lu\n",
+		(unsigned long)g_task_cnt);
+	check(line, g_task_cnt == OS_CFG_NUM_TASKS);
+
+	Console_exit(g_failed ? 1 : 0);
+}
+
+//*****************************************************************************
+//
+//! task_idler takes a TCB and blocks forever.
+//
+//*****************************************************************************
+void task_idler(void)
+{
+	OS_Semaphore_pend(&sema_never);
+}
+
+int main(void)
+{
+	uint32_t i;
+
+	OS_Semaphore_init(&sema_never, 0);
+	if(OS_add_task_stack(&task_check, 1, g_check_stack,
+		CHECK_STACK_SIZE) >= 0)
+	{
+		g_task_cnt++;
+	}
+	// every other TCB is taken
+	for (i = 1; i < OS_CFG_NUM_TASKS; i++)
+	{
+		if(OS_add_task_stack(&task_idler, 2, g_idler_stacks[i],
+			IDLER_STACK_SIZE) >= 0)
+		{
+			g_task_cnt++;
+		}
+	}
+	OS_start();
+
+	// this never executes
+	return 0;
+}
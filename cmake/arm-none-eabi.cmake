@@ -0,0 +1,25 @@
+#******************************************************************************
+#
+#  CMake toolchain file for the GNU Arm Embedded toolchain.
+#
+#  cmake -S . -B build-qemu -DCMAKE_TOOLCHAIN_FILE=cmake/arm-none-eabi.cmake \
+#        -DRTOS_PORT=lm3s6965
+#
+#******************************************************************************
+
+set(CMAKE_SYSTEM_NAME Generic)
+set(CMAKE_SYSTEM_PROCESSOR arm)
+
+set(TOOLCHAIN_PREFIX arm-none-eabi-)
+set(CMAKE_C_COMPILER ${TOOLCHAIN_PREFIX}gcc)
+set(CMAKE_CXX_COMPILER ${TOOLCHAIN_PREFIX}g++)
+set(CMAKE_ASM_COMPILER ${TOOLCHAIN_PREFIX}gcc)
+set(CMAKE_OBJCOPY ${TOOLCHAIN_PREFIX}objcopy CACHE FILEPATH "objcopy")
+set(CMAKE_SIZE ${TOOLCHAIN_PREFIX}size CACHE FILEPATH "size")
+
+# the compiler cannot link a test program without a linker script
+set(CMAKE_TRY_COMPILE_TARGET_TYPE STATIC_LIBRARY)
+
+set(CMAKE_FIND_ROOT_PATH_MODE_PROGRAM NEVER)
+set(CMAKE_FIND_ROOT_PATH_MODE_LIBRARY ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_INCLUDE ONLY)
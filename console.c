@@ -0,0 +1,61 @@
+//*****************************************************************************
+//  console.c - Software functions for the text console
+//  Runs on LM4F120/TM4C123
+//  Ronald Rodriguez Ruiz
+//  October 18, 2026
+//*****************************************************************************
+
+#include <stdint.h>
+#include "console.h"
+#include "cpu.h"
+
+//*****************************************************************************
+//
+//! @brief Write a string to the console.
+//!
+//! This function sends the string through the stimulus port 0 of the ITM, 
+//! which the debugger shows in its printf viewer (SWO trace). Nothing is 
+//! sent if no debugger has enabled the port.
+//!
+//! @param[in] p_str Null-terminated string.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Console_write(const char *p_str)
+{
+	if(((ITM_TCR_R & ITM_TCR_ITMENA) == 0) || 
+		((ITM_TER_R & ITM_TER_STIM0) == 0))
+	{
+		return;
+	}
+
+	while(*p_str)
+	{
+		//
+		//	Wait until the stimulus port is ready
+		//
+		while(ITM_STIM0_R == 0);
+		ITM_STIM0_8_R = (unsigned char)*p_str++;
+	}
+}
+
+//*****************************************************************************
+//
+//! @brief End the console session.
+//!
+//! There is nothing to return to on the board, so the CPU stays halted with 
+//! interrupts disabled.
+//!
+//! @param[in] status Exit status (unused).
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Console_exit(int32_t status)
+{
+	(void)status;
+
+	CPU_disable_irq();
+	while(1);
+}
@@ -0,0 +1,44 @@
+//*****************************************************************************
+//  console.h - Prototypes for the text console
+//  Runs on LM4F120/TM4C123
+//  Ronald Rodriguez Ruiz
+//  October 18, 2026
+//*****************************************************************************
+
+#ifndef __CONSOLE_H__
+#define __CONSOLE_H__
+
+//*****************************************************************************
+//
+//  The following are defines for the Instrumentation Trace Macrocell (ITM)
+//  registers used by the console of the TM4C123. They belong to the Cortex-M4
+//  core and are not part of "tm4c123gh6pm.h".
+//
+//*****************************************************************************
+
+#define ITM_STIM0_R             (*((volatile unsigned long *)0xE0000000))
+#define ITM_STIM0_8_R           (*((volatile unsigned char *)0xE0000000))
+#define ITM_TER_R               (*((volatile unsigned long *)0xE0000E00))
+#define ITM_TCR_R               (*((volatile unsigned long *)0xE0000E80))
+
+#define ITM_TCR_ITMENA          0x00000001  // ITM enable
+#define ITM_TER_STIM0           0x00000001  // Stimulus port 0 enable
+
+//*****************************************************************************
+//
+//  Prototypes for the API
+//
+//*****************************************************************************
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern void Console_write(const char *p_str);
+extern void Console_exit(int32_t status);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // __CONSOLE_H__
@@ -0,0 +1,209 @@
+//*****************************************************************************
+//
+//  Coroutine demo, many flows in one kernel task.
+//  File: 		coro_demo.cpp
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//  The workload of "main.c" written as coroutines (os_coro.hpp), plus 
+//  CORO_FLOWS blinkers that sleep for periods of 1 to 16 ms. Only task_D 
+//  (the fifo producer) and task_F (the background load) are kernel tasks
+//  with a stack of their own. After CORO_RUN_MS the reporter prints the 
+//  counts and the memory taken by the coroutines:
+//
+//    coro flows=200 frames=204 frame_max=56 arena_bytes=26112 a=99 b=49 
+//        c=49 e=245 blinks=... 
+//
+//*****************************************************************************
+//*****************************************************************************
+//
+//  The following are header files for the C standard library.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdio.h>
+
+//*****************************************************************************
+//
+//  This is the application header file.
+//
+//*****************************************************************************
+
+#include "os_coro.hpp"
+#include "console.h"
+
+//*****************************************************************************
+//
+//  The following are defines for the demo. Each can be overridden from the
+//  compiler command line.
+//
+//*****************************************************************************
+
+#ifndef CORO_FLOWS
+#define CORO_FLOWS 			200			// number of blinker coroutines
+#endif
+
+#ifndef CORO_RUN_MS
+#define CORO_RUN_MS 		1000		// time before the report
+#endif
+
+static_assert(CORO_FLOWS + 4 <= OS_CORO_FRAMES, 
+	"OS_CORO_FRAMES too small for the demo");
+
+//*****************************************************************************
+//
+//  The following are global definitions for the demo.
+//
+//*****************************************************************************
+
+static int32_t sema_A, sema_BC;
+static uint32_t cnt_A, cnt_B, cnt_C, cnt_D, cnt_E, cnt_F;
+static uint32_t g_blinks;
+
+//*****************************************************************************
+//
+//! a_flow is an event-driven coroutine that runs every 10 ms.
+//
+//*****************************************************************************
+static os::coro::Task a_flow(void)
+{
+	while(1)
+	{
+		co_await os::coro::pend(&sema_A);	// signaled by OS (periodic event)
+		cnt_A++;
+	}
+}
+
+//*****************************************************************************
+//
+//! Producer/Consumer without fifo, b_flow produces every 20 ms and c_flow
+//! consumes after it.
+//
+//*****************************************************************************
+static os::coro::Task b_flow(void)
+{
+	while(1)
+	{
+		cnt_B++;
+		OS_Semaphore_post(&sema_BC);		// c_flow can be processed
+		co_await os::coro::sleep(20);
+	}
+}
+
+static os::coro::Task c_flow(void)
+{
+	while(1)
+	{
+		co_await os::coro::pend(&sema_BC);	// signaled by b_flow
+		cnt_C = cnt_B;
+	}
+}
+
+//*****************************************************************************
+//
+//! Producer/Consumer with fifo, task_D puts 5 entries every 50 ms and e_flow
+//! consumes them.
+//
+//*****************************************************************************
+static void task_D(void)
+{
+	uint8_t i;
+
+	while(1)
+	{
+		for (i = 0; i < 5; i++)
+		{
+			OS_Fifo_put(++cnt_D);
+		}
+		OS_sleep(50);
+	}
+}
+
+static os::coro::Task e_flow(void)
+{
+	while(1)
+	{
+		cnt_E = co_await os::coro::fifo_get();
+	}
+}
+
+//*****************************************************************************
+//
+//! Blinker, a flow that only sleeps.
+//
+//*****************************************************************************
+static os::coro::Task blink_flow(uint32_t period)
+{
+	while(1)
+	{
+		co_await os::coro::sleep(period);
+		g_blinks++;
+	}
+}
+
+//*****************************************************************************
+//
+//! Reporter, prints the counts once and stops the run.
+//
+//*****************************************************************************
+static os::coro::Task report_flow(void)
+{
+	static char line[160];				// not in the coroutine frame
+
+	co_await os::coro::sleep(CORO_RUN_MS);
+	snprintf(line, sizeof(line), "coro flows=%u frames=%u frame_max=%u "
+		"arena_bytes=%u a=%lu b=%lu c=%lu e=%lu blinks=%lu\n",
+		(unsigned)CORO_FLOWS, (unsigned)os::coro::frames_used(),
+		(unsigned)os::coro::frame_size_max(), 
+		(unsigned)sizeof(os::coro::detail::g_arena), (unsigned long)cnt_A, 
+		(unsigned long)cnt_B, (unsigned long)cnt_C, (unsigned long)cnt_E,
+		(unsigned long)g_blinks);
+	Console_write(line);
+	Console_exit(0);
+}
+
+//*****************************************************************************
+//
+//! task_F is a lower level task that runs a lot.
+//
+//*****************************************************************************
+static void task_F(void)
+{
+	while(1)
+	{
+		cnt_F++;
+	}
+}
+
+int main(void)
+{
+	uint32_t i;
+
+	OS_Fifo_init();
+	OS_Semaphore_init(&sema_A, 0);
+	OS_Semaphore_init(&sema_BC, 0);
+
+	os::coro::spawn(a_flow());
+	os::coro::spawn(b_flow());
+	os::coro::spawn(c_flow());
+	os::coro::spawn(e_flow());
+	for (i = 0; i < CORO_FLOWS; i++)
+	{
+		os::coro::spawn(blink_flow(1 + i % 16));
+	}
+	os::coro::spawn(report_flow());
+
+	// the coroutines run in one task, above the fifo producer
+	OS_add_task(&os::coro::run, 0);
+	OS_add_task(&task_D, 1);
+	OS_add_task(&task_F, 2);
+	// event period is 10 ms
+	OS_add_periodic_event(&sema_A, 10);
+
+	OS_start();
+
+	// this never executes
+	return 0;
+}
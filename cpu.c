@@ -5,8 +5,100 @@
 //  August 16, 2018
 //*****************************************************************************
 
+#include <stdint.h>
 #include "cpu.h"
 
+//*****************************************************************************
+//
+//  Words kept free below a local variable of CPU_restart_stack, for the rest
+//  of its frame and the frame of CPU_init_stack (a few words each).
+//
+//*****************************************************************************
+
+#define CPU_CALL_GAP        16
+
+//*****************************************************************************
+//
+//! @brief Build the initial stack frame of a task.
+//!
+//! This function fills the top of a task stack with the frame that the 
+//! context switch (SysTick_Handler and run_os in "osasm.s") pops: R4-R11 
+//! followed by the exception frame R0-R3, R12, LR, PC and PSR. Registers 
+//! hold their own number to ease debugging.
+//!
+//! @param[in] p_stack_top Pointer past the last word of the stack.
+//! @param[in] p_task Pointer to the task function.
+//!
+//! @return Initial stack pointer of the task.
+//
+//*****************************************************************************
+uint32_t *CPU_init_stack(uint32_t *p_stack_top, void (*p_task)(void))
+{
+    uint32_t *p_sp = p_stack_top - 16;
+
+    p_sp[15] = 0x01000000;          // thumb bit
+    p_sp[14] = (uint32_t)(p_task);  // PC
+    p_sp[13] = 0x14141414;          // R14
+    p_sp[12] = 0x12121212;          // R12
+    p_sp[11] = 0x03030303;          // R3
+    p_sp[10] = 0x02020202;          // R2
+    p_sp[9] = 0x01010101;           // R1
+    p_sp[8] = 0x00000000;           // R0
+    p_sp[7] = 0x11111111;           // R11
+    p_sp[6] = 0x10101010;           // R10
+    p_sp[5] = 0x09090909;           // R9
+    p_sp[4] = 0x08080808;           // R8
+    p_sp[3] = 0x07070707;           // R7
+    p_sp[2] = 0x06060606;           // R6
+    p_sp[1] = 0x05050505;           // R5
+    p_sp[0] = 0x04040404;           // R4
+
+    return p_sp;
+}
+
+//*****************************************************************************
+//
+//! @brief Build a new initial stack frame for a task that has run.
+//!
+//! The frame is the same as from CPU_init_stack, the earlier context of the
+//! task is dropped. The kernel uses it to start a run-to-completion task on
+//! the shared stack, at a different place each time.
+//!
+//! The context switch (SysTick_Handler) and the scheduler that calls this
+//! function run on the stack of the task switched out, below its saved
+//! context. If that task stays on the shared stack, the kernel passes no
+//! stack top, and the frame is built below the live part of the stack:
+//! the handler, the scheduler and this function, with CPU_CALL_GAP words
+//! left for the frames below the local variable that marks it.
+//!
+//! @param[in] p_sp Current stack pointer of the task (unused).
+//! @param[in] p_stack_top Pointer past the last word of the stack, or NULL
+//!            for the stack in use.
+//! @param[in] p_task Pointer to the task function.
+//!
+//! @return Initial stack pointer of the task.
+//
+//*****************************************************************************
+uint32_t *CPU_restart_stack(uint32_t *p_sp, uint32_t *p_stack_top, 
+    void (*p_task)(void))
+{
+    volatile uint32_t live;         // its address is in the live stack
+
+    (void)p_sp;
+
+    if(p_stack_top == 0)
+    {
+        //
+        //  Below this frame and the one of CPU_init_stack, 8-byte aligned
+        //  as a stack on entry to a function (AAPCS)
+        //
+        p_stack_top = (uint32_t *)((uintptr_t)((uint32_t *)&live - 
+            CPU_CALL_GAP) & ~(uintptr_t)7);
+    }
+
+    return CPU_init_stack(p_stack_top, p_task);
+}
+
 #if defined(ccs) //  Code Composer Studio Code
 
 void CPU_disable_irq(void)
@@ -27,6 +119,15 @@ void CPU_enable_irq(void)
           "  bx      lr\n");
 }
 
+void CPU_wait_irq(void)
+{
+    //
+    //  Sleep until an interrupt.
+    //
+    __asm("  wfi\n"
+          "  bx      lr\n");
+}
+
 #endif
 
 #if defined(rvmdk) || defined(__ARMCC_VERSION) //  Keil uVision Code
@@ -49,4 +150,44 @@ __asm void CPU_enable_irq(void)
     bx      lr
 }
 
+__asm void CPU_wait_irq(void)
+{
+    //
+    //  Sleep until an interrupt.
+    //
+    wfi
+    bx      lr
+}
+
+#endif
+
+#if defined(gcc) || (defined(__GNUC__) && !defined(__ARMCC_VERSION)) //  GNU Arm
+
+void __attribute__((naked)) CPU_disable_irq(void)
+{
+    //
+    //  Disable interrupts.
+    //
+    __asm("  cpsid   i\n"
+          "  bx      lr\n");
+}
+
+void __attribute__((naked)) CPU_enable_irq(void)
+{
+    //
+    //  Enable interrupts.
+    //
+    __asm("  cpsie   i\n"
+          "  bx      lr\n");
+}
+
+void __attribute__((naked)) CPU_wait_irq(void)
+{
+    //
+    //  Sleep until an interrupt.
+    //
+    __asm("  wfi\n"
+          "  bx      lr\n");
+}
+
 #endif
@@ -16,5 +16,9 @@
 
 extern void CPU_disable_irq(void);
 extern void CPU_enable_irq(void);
+extern void CPU_wait_irq(void);
+extern uint32_t *CPU_init_stack(uint32_t *p_stack_top, void (*p_task)(void));
+extern uint32_t *CPU_restart_stack(uint32_t *p_sp, uint32_t *p_stack_top, 
+    void (*p_task)(void));
 
 #endif  // __CPU_H__
@@ -0,0 +1,139 @@
+//*****************************************************************************
+//
+//  Demo of the C++ interface of the kernel.
+//  File: 		cxx_demo.cpp
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//  The workload of "main.c" written with "os.hpp": typed semaphores, a
+//  queue of 16-bit samples instead of the 32-bit kernel fifo, a mutex over
+//  the shared counters, and tasks with stacks sized to each one.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include "os.hpp"
+
+//*****************************************************************************
+//
+//  The following are global definitions for the demo.
+//
+//*****************************************************************************
+
+static os::Semaphore sema_A;
+static os::Semaphore sema_BC;
+static os::Queue<uint16_t, 8> g_samples;
+static os::Mutex g_cnt_lock;
+static uint32_t cnt_A, cnt_B, cnt_C, cnt_D, cnt_E, cnt_F;
+
+static os::StaticTask<48> g_task_A;
+static os::StaticTask<48> g_task_B;
+static os::StaticTask<48> g_task_C;
+static os::StaticTask<64> g_task_D;
+static os::StaticTask<64> g_task_E;
+static os::StaticTask<32> g_task_F;
+
+//*****************************************************************************
+//
+//! task_A is a event-drivern task that runs every 10 ms. 
+//
+//*****************************************************************************
+static void task_A(void)
+{
+	while(1)
+	{
+		sema_A.pend();						// signaled by OS (periodic event)
+		cnt_A++;
+	}
+}
+
+//*****************************************************************************
+//
+//! Producer/Consumer without fifo, task_B produces every 20 ms and task_C
+//! consumes after it.
+//
+//*****************************************************************************
+static void task_B(void)
+{
+	uint32_t last_wake = OS_time_ms();
+
+	while(1)
+	{
+		{
+			os::LockGuard<os::Mutex> lock(g_cnt_lock);
+			cnt_B++;
+		}
+		sema_BC.post();						// task c can be processed
+		OS_sleep_until(&last_wake, 20);
+	}
+}
+
+static void task_C(void)
+{
+	while(1)
+	{
+		sema_BC.pend();						// signaled by task b
+		os::LockGuard<os::Mutex> lock(g_cnt_lock);
+		cnt_C = cnt_B;
+	}
+}
+
+//*****************************************************************************
+//
+//! Producer/Consumer with a queue, task_D puts 5 samples every 50 ms and 
+//! task_E consumes them.
+//
+//*****************************************************************************
+static void task_D(void)
+{
+	uint8_t i;
+
+	while(1)
+	{
+		for (i = 0; i < 5; i++)
+		{
+			g_samples.put((uint16_t)++cnt_D);
+		}
+		OS_sleep(50);
+	}
+}
+
+static void task_E(void)
+{
+	while(1)
+	{
+		cnt_E = g_samples.get();
+	}
+}
+
+//*****************************************************************************
+//
+//! task_F is a lower level task that runs a lot.
+//
+//*****************************************************************************
+static void task_F(void)
+{
+	while(1)
+	{
+		cnt_F++;
+	}
+}
+
+int main(void)
+{
+	// A is the highest priority task
+	g_task_A.add(&task_A, 0);
+	g_task_B.add(&task_B, 1);
+	g_task_C.add(&task_C, 2);
+	g_task_D.add(&task_D, 3);
+	g_task_E.add(&task_E, 4);
+	g_task_F.add(&task_F, 5);
+	// event period is 10 ms
+	OS_add_periodic_event(sema_A.native(), 10);
+
+	OS_start();
+
+	// this never executes
+	return 0;
+}
@@ -0,0 +1,145 @@
+//*****************************************************************************
+//
+//  Demo of the static system configuration of the kernel.
+//  File: 		system_demo.cpp
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//  The workload of "cxx_demo.cpp" declared as tables with "os_system.hpp":
+//  the tasks, their stacks and the periodic event are checked at compile
+//  time, and main() only starts the system.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <array>
+#include "os_system.hpp"
+
+//*****************************************************************************
+//
+//  The following are global definitions for the demo.
+//
+//*****************************************************************************
+
+static os::Semaphore sema_A;
+static os::Semaphore sema_BC;
+static os::Queue<uint16_t, 8> g_samples;
+static os::Mutex g_cnt_lock;
+static uint32_t cnt_A, cnt_B, cnt_C, cnt_D, cnt_E, cnt_F;
+
+//*****************************************************************************
+//
+//! task_A is a event-drivern task that runs every 10 ms. 
+//
+//*****************************************************************************
+static void task_A(void)
+{
+	while(1)
+	{
+		sema_A.pend();						// signaled by OS (periodic event)
+		cnt_A++;
+	}
+}
+
+//*****************************************************************************
+//
+//! Producer/Consumer without fifo, task_B produces every 20 ms and task_C
+//! consumes after it.
+//
+//*****************************************************************************
+static void task_B(void)
+{
+	uint32_t last_wake = OS_time_ms();
+
+	while(1)
+	{
+		{
+			os::LockGuard<os::Mutex> lock(g_cnt_lock);
+			cnt_B++;
+		}
+		sema_BC.post();						// task c can be processed
+		OS_sleep_until(&last_wake, 20);
+	}
+}
+
+static void task_C(void)
+{
+	while(1)
+	{
+		sema_BC.pend();						// signaled by task b
+		os::LockGuard<os::Mutex> lock(g_cnt_lock);
+		cnt_C = cnt_B;
+	}
+}
+
+//*****************************************************************************
+//
+//! Producer/Consumer with a queue, task_D puts 5 samples every 50 ms and 
+//! task_E consumes them.
+//
+//*****************************************************************************
+static void task_D(void)
+{
+	uint8_t i;
+
+	while(1)
+	{
+		for (i = 0; i < 5; i++)
+		{
+			g_samples.put((uint16_t)++cnt_D);
+		}
+		OS_sleep(50);
+	}
+}
+
+static void task_E(void)
+{
+	while(1)
+	{
+		cnt_E = g_samples.get();
+	}
+}
+
+//*****************************************************************************
+//
+//! task_F is a lower level task that runs a lot.
+//
+//*****************************************************************************
+static void task_F(void)
+{
+	while(1)
+	{
+		cnt_F++;
+	}
+}
+
+//*****************************************************************************
+//
+//  The following are the tables of the system. A is the highest priority 
+//  task, and its event period is 10 ms.
+//
+//*****************************************************************************
+
+static constexpr std::array g_tasks{
+	os::TaskCfg{&task_A, 0, 48},
+	os::TaskCfg{&task_B, 1, 48},
+	os::TaskCfg{&task_C, 2, 48},
+	os::TaskCfg{&task_D, 3, 64},
+	os::TaskCfg{&task_E, 4, 64},
+	os::TaskCfg{&task_F, 5, 32},
+};
+
+static constexpr std::array g_events{
+	os::EventCfg{sema_A, 10},
+};
+
+static os::System<g_tasks, g_events> g_system;
+
+int main(void)
+{
+	g_system.start();
+
+	// this never executes
+	return 0;
+}
@@ -0,0 +1,46 @@
+//*****************************************************************************
+//  dwt.c - Software functions for the Data Watchpoint and Trace (DWT) unit
+//  Runs on LM4F120/TM4C123
+//  Ronald Rodriguez Ruiz
+//  October 18, 2026
+//*****************************************************************************
+
+#include <stdint.h>
+#include "dwt.h"
+
+//*****************************************************************************
+//
+//! @brief Initialize the DWT cycle counter.
+//!
+//! This function enables the trace unit and starts the free-running 32-bit 
+//! cycle counter (CYCCNT) from zero. At 80 MHz the counter wraps every 
+//! 53.6 s, so intervals must be computed with unsigned subtraction.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void DWT_init(void)
+{
+	//
+	//	Enable the DWT unit
+	//
+	CORE_DEMCR_R |= CORE_DEMCR_TRCENA;
+
+	//
+	//	Reset and start the cycle counter
+	//
+	DWT_CYCCNT_R = 0;
+	DWT_CTRL_R |= DWT_CTRL_CYCCNTENA;
+}
+
+//*****************************************************************************
+//
+//! @brief Read the DWT cycle counter.
+//!
+//! @return Number of core clock cycles elapsed since DWT_init().
+//
+//*****************************************************************************
+uint32_t DWT_get_cycles(void)
+{
+	return DWT_CYCCNT_R;
+}
@@ -0,0 +1,35 @@
+//*****************************************************************************
+//  dwt.h - Prototypes and Register Definitions for the Data Watchpoint and 
+//  Trace (DWT) unit
+//  Runs on LM4F120/TM4C123
+//  Ronald Rodriguez Ruiz
+//  October 18, 2026
+//*****************************************************************************
+
+#ifndef __DWT_H__
+#define __DWT_H__
+
+//*****************************************************************************
+//
+//  The following are defines for the DWT and debug registers. They belong to
+//  the Cortex-M4 core and are not part of "tm4c123gh6pm.h".
+//
+//*****************************************************************************
+
+#define DWT_CTRL_R              (*((volatile unsigned long *)0xE0001000))
+#define DWT_CYCCNT_R            (*((volatile unsigned long *)0xE0001004))
+#define CORE_DEMCR_R            (*((volatile unsigned long *)0xE000EDFC))
+
+#define DWT_CTRL_CYCCNTENA      0x00000001  // Enable cycle counter
+#define CORE_DEMCR_TRCENA       0x01000000  // Enable DWT and ITM units
+
+//*****************************************************************************
+//
+//  Prototypes for the API
+//
+//*****************************************************************************
+
+extern void DWT_init(void);
+extern uint32_t DWT_get_cycles(void);
+
+#endif  // __DWT_H__
@@ -0,0 +1,434 @@
+//*****************************************************************************
+//
+//  Fixed-memory log-linear histograms.
+//  File: 		hist.c
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//*****************************************************************************
+//*****************************************************************************
+//
+//  The following are header files for the C standard library.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//*****************************************************************************
+//
+//  This is the application header file.
+//
+//*****************************************************************************
+
+#include "hist.h"
+
+//*****************************************************************************
+//
+//  The following are defines for the compiler intrinsics. The Cortex-M3/M4
+//  have CLZ and exclusive load/store instructions.
+//
+//*****************************************************************************
+
+#if defined(__GNUC__)
+#define CLZ(x) 				__builtin_clz(x)
+#else	// Keil uVision and Code Composer Studio
+#define CLZ(x) 				__clz(x)
+#endif
+
+//*****************************************************************************
+//
+//  Functions for the internal use.
+//
+//*****************************************************************************
+//*****************************************************************************
+//
+//! @brief Get the bucket of a value.
+//!
+//! Values below HIST_SUB_BUCKETS map to themselves. Above, the group is the
+//! position of the most significant bit and the bucket within the group is 
+//! given by the next HIST_SUB_BITS bits.
+//!
+//! @param[in] value Value to be recorded.
+//!
+//! @return Index of the bucket.
+//
+//*****************************************************************************
+static uint32_t bucket_index(uint32_t value)
+{
+	uint32_t group;
+
+	if(value < HIST_SUB_BUCKETS)
+	{
+		return value;
+	}
+	group = 32 - HIST_SUB_BITS - CLZ(value);
+	return (group << HIST_SUB_BITS) + (value >> (group - 1)) - 
+		HIST_SUB_BUCKETS;
+}
+
+//*****************************************************************************
+//
+//! @brief Get the smallest value of a bucket.
+//
+//*****************************************************************************
+static uint32_t bucket_lower(uint32_t idx)
+{
+	uint32_t group = idx >> HIST_SUB_BITS;
+	uint32_t sub = idx & (HIST_SUB_BUCKETS - 1);
+
+	if(group == 0)
+	{
+		return sub;
+	}
+	return (uint32_t)(HIST_SUB_BUCKETS + sub) << (group - 1);
+}
+
+//*****************************************************************************
+//
+//! @brief Get the largest value of a bucket.
+//
+//*****************************************************************************
+static uint32_t bucket_upper(uint32_t idx)
+{
+	uint32_t group = idx >> HIST_SUB_BITS;
+
+	if(group == 0)
+	{
+		return idx;
+	}
+	return bucket_lower(idx) + ((uint32_t)1 << (group - 1)) - 1;
+}
+
+//*****************************************************************************
+//
+//! @brief Atomic operations on a 32-bit word.
+//!
+//! These functions use exclusive accesses, so a histogram can be updated 
+//! from tasks and ISRs at the same time without disabling interrupts.
+//
+//*****************************************************************************
+static void atomic_add(volatile uint32_t *p_val, uint32_t inc)
+{
+#if defined(__GNUC__)
+	__atomic_fetch_add(p_val, inc, __ATOMIC_RELAXED);
+#else	// Keil uVision and Code Composer Studio
+	uint32_t val;
+
+	do
+	{
+		val = __ldrex(p_val);
+	} while(__strex(val + inc, p_val));
+#endif
+}
+
+static void atomic_min(volatile uint32_t *p_val, uint32_t val)
+{
+#if defined(__GNUC__)
+	uint32_t cur = *p_val;
+
+	while(val < cur && !__atomic_compare_exchange_n(p_val, &cur, val, true, 
+		__ATOMIC_RELAXED, __ATOMIC_RELAXED));
+#else	// Keil uVision and Code Composer Studio
+	do
+	{
+		if(val >= __ldrex(p_val))
+		{
+			__clrex();
+			return;
+		}
+	} while(__strex(val, p_val));
+#endif
+}
+
+static void atomic_max(volatile uint32_t *p_val, uint32_t val)
+{
+#if defined(__GNUC__)
+	uint32_t cur = *p_val;
+
+	while(val > cur && !__atomic_compare_exchange_n(p_val, &cur, val, true, 
+		__ATOMIC_RELAXED, __ATOMIC_RELAXED));
+#else	// Keil uVision and Code Composer Studio
+	do
+	{
+		if(val <= __ldrex(p_val))
+		{
+			__clrex();
+			return;
+		}
+	} while(__strex(val, p_val));
+#endif
+}
+
+//*****************************************************************************
+//
+//! @brief Little endian accesses to unaligned fields of a blob.
+//
+//*****************************************************************************
+static void put_le(uint8_t *p_buf, uint32_t val, uint8_t len)
+{
+	uint8_t i;
+
+	for (i = 0; i < len; i++)
+	{
+		p_buf[i] = (uint8_t)(val >> (8 * i));
+	}
+}
+
+static uint32_t get_le(const uint8_t *p_buf, uint8_t len)
+{
+	uint32_t val = 0;
+	uint8_t i;
+
+	for (i = 0; i < len; i++)
+	{
+		val |= (uint32_t)p_buf[i] << (8 * i);
+	}
+	return val;
+}
+
+//*****************************************************************************
+//
+//  Functions for the API.
+//
+//*****************************************************************************
+//*****************************************************************************
+//
+//! @brief Initialize a histogram.
+//!
+//! @param[out] p_hist Pointer to the histogram.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Hist_init(struct hist *p_hist)
+{
+	uint32_t i;
+
+	p_hist->min = UINT32_MAX;
+	p_hist->max = 0;
+	for (i = 0; i < HIST_BUCKETS; i++)
+	{
+		p_hist->buckets[i] = 0;
+	}
+}
+
+//*****************************************************************************
+//
+//! @brief Record a value.
+//!
+//! This function runs in constant time and can be called from tasks and 
+//! ISRs (WideTimer5A_Handler included) on the same histogram.
+//!
+//! @param[in,out] p_hist Pointer to an initialized histogram.
+//! @param[in] value Value to be recorded.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Hist_record(struct hist *p_hist, uint32_t value)
+{
+	atomic_add(&p_hist->buckets[bucket_index(value)], 1);
+	atomic_min(&p_hist->min, value);
+	atomic_max(&p_hist->max, value);
+}
+
+//*****************************************************************************
+//
+//! @brief Add the counts of a histogram to another.
+//!
+//! @param[in,out] p_dst Pointer to the histogram that receives the counts.
+//! @param[in] p_src Pointer to the histogram to be added.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Hist_merge(struct hist *p_dst, const struct hist *p_src)
+{
+	uint32_t i;
+
+	for (i = 0; i < HIST_BUCKETS; i++)
+	{
+		if(p_src->buckets[i])
+		{
+			atomic_add(&p_dst->buckets[i], p_src->buckets[i]);
+		}
+	}
+	atomic_min(&p_dst->min, p_src->min);
+	atomic_max(&p_dst->max, p_src->max);
+}
+
+//*****************************************************************************
+//
+//! @brief Get the number of values recorded.
+//
+//*****************************************************************************
+uint32_t Hist_count(const struct hist *p_hist)
+{
+	uint32_t i, cnt = 0;
+
+	for (i = 0; i < HIST_BUCKETS; i++)
+	{
+		cnt += p_hist->buckets[i];
+	}
+	return cnt;
+}
+
+//*****************************************************************************
+//
+//! @brief Get the mean of the values recorded.
+//!
+//! Every value counts as the middle of its bucket.
+//!
+//! @param[in] p_hist Pointer to the histogram.
+//!
+//! @return Mean value, 0 if the histogram is empty.
+//
+//*****************************************************************************
+uint32_t Hist_mean(const struct hist *p_hist)
+{
+	uint32_t i, cnt = 0, mid;
+	uint64_t sum = 0;
+
+	for (i = 0; i < HIST_BUCKETS; i++)
+	{
+		if(p_hist->buckets[i])
+		{
+			mid = bucket_lower(i) + (bucket_upper(i) - bucket_lower(i)) / 2;
+			sum += (uint64_t)mid * p_hist->buckets[i];
+			cnt += p_hist->buckets[i];
+		}
+	}
+	return cnt ? (uint32_t)(sum / cnt) : 0;
+}
+
+//*****************************************************************************
+//
+//! @brief Get a percentile of the values recorded.
+//!
+//! @param[in] p_hist Pointer to the histogram.
+//! @param[in] per_10k Percentile in hundredths of a percent (e.g. 9900 is 
+//! the 99th percentile, 10000 is the maximum).
+//!
+//! @return Largest value of the bucket that holds the percentile (never 
+//! above the maximum), 0 if the histogram is empty.
+//
+//*****************************************************************************
+uint32_t Hist_percentile(const struct hist *p_hist, uint32_t per_10k)
+{
+	uint32_t i, cnt = 0, target, upper;
+
+	// rank of the value (rounded up), at least the first one
+	target = (uint32_t)(((uint64_t)Hist_count(p_hist) * per_10k + 9999) / 
+		10000);
+	target = target ? target : 1;
+
+	for (i = 0; i < HIST_BUCKETS; i++)
+	{
+		cnt += p_hist->buckets[i];
+		if(cnt >= target)
+		{
+			upper = bucket_upper(i);
+			return upper < p_hist->max ? upper : p_hist->max;
+		}
+	}
+	return 0;
+}
+
+//*****************************************************************************
+//
+//! @brief Export a histogram as a binary blob.
+//!
+//! Only the non empty buckets are written (see hist.h for the layout).
+//!
+//! @param[in] p_hist Pointer to the histogram.
+//! @param[out] p_buf Buffer that receives the blob.
+//! @param[in] size Size of the buffer (HIST_EXPORT_SIZE is always enough).
+//!
+//! @return Number of bytes written, 0 if the buffer is too small.
+//
+//*****************************************************************************
+uint32_t Hist_export(const struct hist *p_hist, uint8_t *p_buf, uint32_t size)
+{
+	uint32_t i, len = 16;
+	uint16_t entries = 0;
+
+	for (i = 0; i < HIST_BUCKETS; i++)
+	{
+		if(p_hist->buckets[i])
+		{
+			if(len + 6 > size)
+			{
+				return 0;
+			}
+			put_le(&p_buf[len], i, 2);
+			put_le(&p_buf[len + 2], p_hist->buckets[i], 4);
+			len += 6;
+			entries++;
+		}
+	}
+	if(size < 16)
+	{
+		return 0;
+	}
+
+	put_le(&p_buf[0], HIST_MAGIC, 4);
+	p_buf[4] = HIST_VERSION;
+	p_buf[5] = HIST_SUB_BITS;
+	put_le(&p_buf[6], entries, 2);
+	put_le(&p_buf[8], p_hist->min, 4);
+	put_le(&p_buf[12], p_hist->max, 4);
+
+	return len;
+}
+
+//*****************************************************************************
+//
+//! @brief Add the counts of an exported blob to a histogram.
+//!
+//! Importing into an initialized histogram restores the exported one, 
+//! importing several blobs merges them.
+//!
+//! @param[in,out] p_hist Pointer to an initialized histogram.
+//! @param[in] p_buf Blob written by Hist_export().
+//! @param[in] size Size of the blob.
+//!
+//! @return Number of bytes read, -1 if the blob is invalid or was exported
+//! with another HIST_SUB_BITS.
+//
+//*****************************************************************************
+int32_t Hist_import(struct hist *p_hist, const uint8_t *p_buf, uint32_t size)
+{
+	uint32_t i, idx, entries, len;
+
+	if(size < 16 || get_le(&p_buf[0], 4) != HIST_MAGIC || 
+		p_buf[4] != HIST_VERSION || p_buf[5] != HIST_SUB_BITS)
+	{
+		return -1;
+	}
+	entries = get_le(&p_buf[6], 2);
+	len = 16 + 6 * entries;
+	if(len > size)
+	{
+		return -1;
+	}
+
+	// check all the entries before touching the histogram
+	for (i = 0; i < entries; i++)
+	{
+		if(get_le(&p_buf[16 + 6 * i], 2) >= HIST_BUCKETS)
+		{
+			return -1;
+		}
+	}
+	for (i = 0; i < entries; i++)
+	{
+		idx = get_le(&p_buf[16 + 6 * i], 2);
+		atomic_add(&p_hist->buckets[idx], get_le(&p_buf[18 + 6 * i], 4));
+	}
+	atomic_min(&p_hist->min, get_le(&p_buf[8], 4));
+	atomic_max(&p_hist->max, get_le(&p_buf[12], 4));
+
+	return (int32_t)len;
+}
@@ -0,0 +1,87 @@
+//*****************************************************************************
+//
+//  Prototypes and data structures for the latency histograms.
+//  File: 		hist.h
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//  A histogram counts 32-bit values (usually cycles) in log-linear buckets,
+//  as HdrHistogram does: values below HIST_SUB_BUCKETS have a bucket each,
+//  and every power of two above is split into HIST_SUB_BUCKETS buckets, so 
+//  the relative error is below 1 / HIST_SUB_BUCKETS over the whole range.
+//  The memory is fixed, there are no floats, and recording a value takes a
+//  CLZ and three atomic updates without disabling interrupts.
+//
+//*****************************************************************************
+
+#ifndef __HIST_H__
+#define __HIST_H__
+
+#include "os_config.h"
+
+//*****************************************************************************
+//
+//  The following are defines for the histogram layout.
+//
+//*****************************************************************************
+
+#define HIST_SUB_BITS 		OS_CFG_HIST_SUB_BITS
+#define HIST_SUB_BUCKETS 	(1 << HIST_SUB_BITS)
+#define HIST_BUCKETS 		((33 - HIST_SUB_BITS) * HIST_SUB_BUCKETS)
+
+//*****************************************************************************
+//
+//  The following are defines for the exported blob. All the fields are 
+//  little endian and unaligned:
+//
+//    offset 0   u32 magic (HIST_MAGIC)
+//    offset 4   u8  version (HIST_VERSION)
+//    offset 5   u8  HIST_SUB_BITS of the exporter
+//    offset 6   u16 number of entries
+//    offset 8   u32 min
+//    offset 12  u32 max
+//    offset 16  entries, one per non empty bucket: u16 index, u32 count
+//
+//*****************************************************************************
+
+#define HIST_MAGIC 			0x54534948	// "HIST" in little endian
+#define HIST_VERSION 		1
+#define HIST_EXPORT_SIZE 	(16 + 6 * HIST_BUCKETS)	// worst case (bytes)
+
+//*****************************************************************************
+//
+//  This data structure defines a histogram. It must be initialized with 
+//  Hist_init() (or HIST_INITIALIZER) before use.
+//
+//*****************************************************************************
+
+struct hist
+{
+	volatile uint32_t min;						// smallest value recorded
+	volatile uint32_t max;						// largest value recorded
+	volatile uint32_t buckets[HIST_BUCKETS];	// count per bucket
+};
+
+#define HIST_INITIALIZER 	{ .min = UINT32_MAX, .max = 0 }
+
+//*****************************************************************************
+//
+//	Prototypes for the API
+//
+//*****************************************************************************
+
+extern void Hist_init(struct hist *p_hist);
+extern void Hist_record(struct hist *p_hist, uint32_t value);
+extern void Hist_merge(struct hist *p_dst, const struct hist *p_src);
+
+extern uint32_t Hist_count(const struct hist *p_hist);
+extern uint32_t Hist_mean(const struct hist *p_hist);
+extern uint32_t Hist_percentile(const struct hist *p_hist, uint32_t per_10k);
+
+extern uint32_t Hist_export(const struct hist *p_hist, uint8_t *p_buf, 
+	uint32_t size);
+extern int32_t Hist_import(struct hist *p_hist, const uint8_t *p_buf, 
+	uint32_t size);
+
+#endif	// __HIST_H__
@@ -22,18 +22,19 @@ void task_A(void)
 //*****************************************************************************
 //
 //! Producer/Consumer without fifo
-//! task_B is a data producer that runs periodically every 20 ms (sleep)
+//! task_B is a data producer that runs periodically every 20 ms (sleep until)
 //! task_C is a data consumer that runs afters task_B finishes
 //
 //*****************************************************************************
 void task_B(void)
 { 
+	uint32_t last_wake = OS_time_ms();
 	cnt_B = 0;
 	while(1)
 	{
 		cnt_B++;
 		OS_Semaphore_post(&sema_BC); // task c can be processed
-		OS_sleep(20);
+		OS_sleep_until(&last_wake, 20);
 	}
 }
 
@@ -23,6 +23,12 @@
 //*****************************************************************************
 
 #include "os.h"
+#include "trace.h"
+#include "hist.h"
+#include "profile.h"
+#if OS_CFG_RTA
+#include "rta.h"
+#endif
 
 //*****************************************************************************
 //
@@ -34,29 +40,87 @@
 #include "pll.h"
 #include "timer.h"
 #include "systick.h"
+#include "dwt.h"
 
 //*****************************************************************************
 //
-//  The following are defines for the operating frequencies (Hz) of the OS.
+//  The following is the check of the initial tick rate (OS_CFG_TICK_FREQ), 
+//  which must be a whole number of microseconds (see OS_set_tick_freq).
 //
 //*****************************************************************************
 
-#define CPU_CLOCK_FREQ		80000000
-#define EVENT_FREQ 			1000   		// Frequency at which the real-time 
-										// events are executed
-#define TASK_FREQ 			1000		// Frequency at which tasks are 
-										// switched 
+#if (1000000 % OS_CFG_TICK_FREQ) != 0 || (CPU_CLOCK_FREQ % OS_CFG_TICK_FREQ) != 0
+#error "OS_CFG_TICK_FREQ must divide 1000000 and CPU_CLOCK_FREQ"
+#endif
 
 //*****************************************************************************
 //
-//  The following are defines for the TCB and FIFO static memory allocation.
+//  The following are defines for the TCB and FIFO static memory allocation
+//  (see os_config.h).
 //
 //*****************************************************************************
 
-#define NUM_TASKS  	  		8        	// max number of task
-#define NUM_EVENTS  	  	2        	// max number of events
-#define STACK_SIZE   		100			// number of 32-bit words per task
-#define FIFO_SIZE 			10    		// max number of entries in the FIFO
+#define NUM_TASKS  	  		OS_CFG_NUM_TASKS	// max number of task
+#define NUM_EVENTS  	  	OS_CFG_NUM_EVENTS	// max number of events
+#define STACK_SIZE   		OS_CFG_STACK_SIZE	// number of 32-bit words per 
+												// task
+#define FIFO_SIZE 			OS_CFG_FIFO_SIZE	// max number of entries in the
+												// FIFO
+#define NUM_STACKS 			OS_CFG_NUM_STACKS	// rows of g_stacks
+
+#if (NUM_TASKS < 1) || (NUM_TASKS > 255) || (NUM_EVENTS < 1) || \
+	(NUM_EVENTS > 255) || (FIFO_SIZE < 1)
+#error "OS_CFG_NUM_TASKS, OS_CFG_NUM_EVENTS and OS_CFG_FIFO_SIZE out of range"
+#endif
+
+#if (NUM_STACKS < 0) || (NUM_STACKS > NUM_TASKS)
+#error "OS_CFG_NUM_STACKS must be from 0 to OS_CFG_NUM_TASKS"
+#endif
+
+#if OS_CFG_TIMER && (NUM_TASKS > 254)
+#error "OS_CFG_TIMER needs a task id, OS_CFG_NUM_TASKS must be up to 254"
+#endif
+
+#if OS_CFG_RTC && OS_CFG_EDF
+#error "OS_CFG_RTC requires the fixed priority scheduling (OS_CFG_EDF 0)"
+#endif
+
+//*****************************************************************************
+//
+//  The following are defines for the kernel trace points.
+//
+//*****************************************************************************
+
+#define TASK_ID(p_tcb)		((uint8_t)((p_tcb) - g_tcbs))
+#define IDLE_TASK 			(&g_tcbs[NUM_TASKS])	// TCB of the idle task
+#define IDLE_PRIORITY 		255			// below every task
+#define IDLE_STACK_SIZE 	OS_STACK_MIN_SIZE	// words of the idle stack
+#define TIMER_TASK 			(&g_tcbs[NUM_TASKS + 1])	// TCB of the timer task
+
+#if OS_CFG_TRACE
+#define TRACE(event, task, object) \
+	Trace_record((event), (task), (uint32_t)(uintptr_t)(object))
+#else
+#define TRACE(event, task, object)
+#endif
+
+//*****************************************************************************
+//
+//  The following are defines for the kernel critical sections. With 
+//  OS_CFG_IRQ_OFF_TRACK, every section is timed and the longest one is kept 
+//  along with the place where it started.
+//
+//*****************************************************************************
+
+#if OS_CFG_IRQ_OFF_TRACK
+#define IRQ_DISABLE() \
+	do { CPU_disable_irq(); irq_off_enter(__func__, __LINE__); } while(0)
+#define IRQ_ENABLE() \
+	do { irq_off_exit(); CPU_enable_irq(); } while(0)
+#else
+#define IRQ_DISABLE()		CPU_disable_irq()
+#define IRQ_ENABLE()		CPU_enable_irq()
+#endif
 
 //*****************************************************************************
 //
@@ -70,7 +134,43 @@ struct tcb
 	int32_t *blocked;    	// nonzero if blocked on this semaphore
 	uint32_t sleep;   		// nonzero if this task is sleep
 	uint8_t priority;    	// 0 is highest, 254 is lowest
+	uint8_t threshold;		// preemption threshold (priority if none)
 	struct tcb *next;    	// linked-list pointer
+	uint32_t quantum;		// time slice in ms (0 is one tick)
+	uint32_t slice;			// ticks left of the time slice
+#if OS_CFG_TASK_STATS
+	uint64_t cycles;		// CPU cycles consumed so far
+	uint32_t preemptions;	// times switched out while still ready
+	uint32_t yields;		// times the CPU was released voluntarily
+#endif
+#if OS_CFG_HIST
+	uint32_t wake_stamp;	// cycle count when made ready (0 if not woken)
+#endif
+#if OS_CFG_HRTIMER
+	uint64_t hr_wake;		// OS_time_us() to wake at (OS_sleep_us)
+	struct tcb *hr_next;	// next task of the high-resolution sleep list
+#endif
+#if OS_CFG_BUDGET
+	uint32_t budget;		// CPU time per period (us), 0 if unlimited
+	uint32_t budget_period;	// time between replenishments (us)
+	uint32_t budget_used;	// CPU time used in the current period (us)
+	uint32_t budget_next;	// time left to the next replenishment (us)
+	uint8_t base_priority;	// priority within the budget
+	uint8_t base_threshold;	// preemption threshold within the budget
+	uint8_t budget_demote;	// 1 to demote instead of suspend when exhausted
+#endif
+#if OS_CFG_RTC
+	void (*p_job)(void);	// run-to-completion function (NULL if the task
+							// has its own stack)
+	int32_t *p_job_sema;	// semaphore that activates the job
+	struct tcb *rtc_prev;	// task below on the shared stack
+	uint8_t rtc_state;		// RTC_IDLE, RTC_RUN or RTC_DONE
+#endif
+#if OS_CFG_EDF
+	uint32_t deadline;		// absolute deadline (tick), if has_deadline
+	uint8_t has_deadline;	// 1 once released with a deadline
+	uint8_t heap_idx;		// index in the ready heap (EDF_NONE if not ready)
+#endif
 };
 
 //*****************************************************************************
@@ -82,7 +182,8 @@ struct tcb
 struct ecb
 {
 	int32_t *semaphore;		 
-	uint32_t period;		
+	uint32_t period;		// in ticks
+	uint32_t period_ms;		// as added (the ticks follow the tick rate)
 };
 
 //*****************************************************************************
@@ -91,11 +192,196 @@ struct ecb
 //
 //*****************************************************************************
 
-static struct tcb g_tcbs[NUM_TASKS];			// one TCB per task 
+static struct tcb g_tcbs[NUM_TASKS + 1 + OS_CFG_TIMER] 
+	OS_SECTION(".bss.os_kernel");				// one TCB per task, the idle
+												// task (IDLE_TASK) and the 
+												// timer task (TIMER_TASK)
+static uint32_t g_idle_stack[IDLE_STACK_SIZE] 
+	OS_SECTION(".bss.os_stacks");				// stack of the idle task
+#if OS_CFG_TIMER
+static uint32_t g_timer_stack[OS_CFG_TIMER_STACK_SIZE] 
+	OS_SECTION(".bss.os_stacks");				// stack of the timer task
+#endif
 struct tcb *gp_running_task;					// pointer to the running task
-static uint32_t g_stacks[NUM_TASKS][STACK_SIZE];// a hundred elments per task
-static struct ecb g_ecbs[NUM_EVENTS];			// one ECB per event
+#if NUM_STACKS > 0
+static uint32_t g_stacks[NUM_STACKS][STACK_SIZE] 
+	OS_SECTION(".bss.os_stacks");				// a hundred elments per task
+#endif
+static uint8_t g_task_cnt = 0;					// number of tasks added
+#if NUM_STACKS > 0
+static uint8_t g_stack_cnt = 0;					// number of stacks taken
+#endif
+static bool g_yield;							// true if the running task 
+												// called OS_suspend() 
+												// (voluntary release)
+static struct ecb g_ecbs[NUM_EVENTS] 
+	OS_SECTION(".bss.os_kernel");				// one ECB per event
 static uint8_t g_event_cnt = 0;					// number of events added
+#if OS_CFG_RTA
+static struct rta_task g_rta_set[NUM_EVENTS]
+	OS_SECTION(".bss.os_kernel");				// events added with a WCET
+static uint8_t g_rta_cnt = 0;					// number of them
+#endif
+
+//*****************************************************************************
+//
+//	The following are global definitios for the system time. The 64-bit tick
+//	count is kept in two words written only by WideTimer5A_Handler, and read
+//	without a critical section (see OS_time_ticks). The tick rate can change
+//	at run time, so the time in microseconds is kept apart.
+//
+//*****************************************************************************
+
+static volatile uint32_t g_ticks_lo;	// ticks since OS_start
+static volatile uint32_t g_ticks_hi;	// carries of g_ticks_lo
+static volatile uint64_t g_time_us;		// time of the last tick (us)
+static volatile uint32_t g_tick_period;	// wide timer 5A reload (0 if the 
+										// kernel has not started)
+static volatile uint32_t g_tick_freq = OS_CFG_TICK_FREQ;	// tick rate (Hz)
+static volatile uint32_t g_tick_us = 1000000 / OS_CFG_TICK_FREQ;
+static volatile uint32_t g_tick_freq_next;	// rate to switch to at the next
+											// tick (0 if none)
+
+//*****************************************************************************
+//
+//	The following are global definitios for the high-resolution sleeps. The
+//	sleeping tasks are blocked on g_hr_wait, sorted by wake time, and the 
+//	wide timer 3A one-shot is armed for the first one only.
+//
+//*****************************************************************************
+
+#if OS_CFG_HRTIMER
+static int32_t g_hr_wait;				// never posted, only blocked on
+static struct tcb *gp_hr_head;			// next task to wake (NULL if none)
+#endif
+
+//*****************************************************************************
+//
+//	The following are global definitios for the run-to-completion tasks. 
+//	They run on g_rtc_stack, one on top of the other in the order they were
+//	started, and only the last one started (gp_rtc_top) may run. A task is 
+//	started only above the priority of gp_rtc_top, as in the Stack Resource
+//	Policy, so the ones below never wait for a task of lower priority.
+//
+//*****************************************************************************
+
+#if OS_CFG_RTC
+#define RTC_IDLE 			0			// not on the shared stack
+#define RTC_RUN 			1			// started, holds the shared stack
+#define RTC_DONE 			2			// pending the next activation
+
+static uint32_t g_rtc_stack[OS_CFG_RTC_STACK_SIZE]
+	OS_SECTION(".bss.os_stacks");		// shared by the run-to-completion 
+										// tasks
+static struct tcb *gp_rtc_top;			// last one started (NULL if none)
+
+#define RTC_CAN_RUN(p_tcb, p_top)	rtc_can_run((p_tcb), (p_top))
+#else
+#define RTC_CAN_RUN(p_tcb, p_top)	true
+#endif
+
+//*****************************************************************************
+//
+//	The following are global definitios for the CPU budgets. Each tick is 
+//	charged to the running task. A task out of budget is blocked on 
+//	g_budget_wait, or moved to BUDGET_PRIORITY, until the replenishment.
+//
+//*****************************************************************************
+
+#if OS_CFG_BUDGET
+#define BUDGET_PRIORITY 	254			// priority of a demoted task
+
+static int32_t g_budget_wait;			// never posted, only blocked on
+#endif
+
+//*****************************************************************************
+//
+//	The following are global definitios for the EDF scheduling. The ready 
+//	tasks are kept in a binary min-heap by deadline, so the scheduler takes
+//	the root, and a task made ready or not costs O(log n). Tasks without a 
+//	deadline come after the others, by priority.
+//
+//*****************************************************************************
+
+#if OS_CFG_EDF
+#define EDF_NONE			0xFF		// heap_idx of a task that is not ready
+
+static struct tcb *gp_edf_heap[NUM_TASKS + OS_CFG_TIMER]
+	OS_SECTION(".bss.os_kernel");		// ready tasks, earliest first
+static uint8_t g_edf_cnt;				// number of ready tasks
+
+#define EDF_READY(p_tcb)	edf_insert(p_tcb)
+#define EDF_UNREADY(p_tcb)	edf_remove(p_tcb)
+#define PREEMPTS(p_a, p_b)	edf_before((p_a), (p_b))
+#else
+#define EDF_READY(p_tcb)
+#define EDF_UNREADY(p_tcb)
+#define PREEMPTS(p_a, p_b)	((p_a)->priority < (p_b)->threshold)
+#endif
+
+//*****************************************************************************
+//
+//	The following are global definitios for the software timers. A timer 
+//	waits in the wheel slot of its expiry tick (modulo the wheel size), so 
+//	start and stop are O(1) and each tick looks at one slot only.
+//
+//*****************************************************************************
+
+#if OS_CFG_TIMER
+#if (OS_CFG_TIMER_WHEEL & (OS_CFG_TIMER_WHEEL - 1)) != 0
+#error "OS_CFG_TIMER_WHEEL must be a power of two"
+#endif
+#define TIMER_SLOT(tick)	((tick) & (OS_CFG_TIMER_WHEEL - 1))
+
+static struct os_timer *gp_wheel[OS_CFG_TIMER_WHEEL]
+	OS_SECTION(".bss.os_kernel");		// timers by expiry tick
+static int32_t g_timer_sema;			// ticks to be run by the service task
+static uint32_t g_timer_tick;			// last tick run by the service task
+#endif
+
+//*****************************************************************************
+//
+//	The following are global definitios for the task statistics.
+//
+//*****************************************************************************
+
+#if OS_CFG_TASK_STATS
+static uint32_t g_switch_stamp;			// cycle count at the last switch
+#endif
+
+//*****************************************************************************
+//
+//	The following are global definitios for the kernel histograms. They are 
+//	found by the debugger through their symbols, so they must not be static.
+//
+//*****************************************************************************
+
+#if OS_CFG_HIST
+struct hist g_hist_sched = HIST_INITIALIZER;	// scheduler run time
+struct hist g_hist_wake = HIST_INITIALIZER;		// ready to running
+struct hist g_hist_isr = HIST_INITIALIZER;		// WideTimer5A_Handler time
+
+// stamps are never 0, which means "not woken"
+#define WAKE_STAMP(p_tcb)	((p_tcb)->wake_stamp = DWT_get_cycles() | 1)
+#else
+#define WAKE_STAMP(p_tcb)
+#endif
+
+//*****************************************************************************
+//
+//	The following are global definitios for the interrupts-disabled tracker.
+//
+//*****************************************************************************
+
+#if OS_CFG_IRQ_OFF_TRACK
+static struct os_irq_off g_irq_off;		// longest section so far
+static uint32_t g_irq_off_stamp;		// cycle count at the current entry
+static const char *gp_irq_off_func;		// site of the current entry (NULL
+static uint16_t g_irq_off_line;			// if interrupts are enabled)
+#if OS_CFG_HIST
+struct hist g_hist_irq_off = HIST_INITIALIZER;	// every section
+#endif
+#endif
 
 //*****************************************************************************
 //
@@ -116,9 +402,50 @@ static int32_t  g_fifo_curr_size;		// current size (0 is emtpy,
 //*****************************************************************************
 
 extern void run_os(void);	// defined in "osasm.s"
+static uint32_t ms_to_ticks(uint32_t ms);
+static uint32_t tick_rescale(uint32_t ticks, uint32_t from, uint32_t to);
+static void tick_rate_apply(uint32_t freq);
+static void slice_reload(struct tcb *p_tcb);
 static void update_sleep_time(void);
-static void init_task_stack(uint8_t task);
+#if OS_CFG_BUDGET
+static void update_budgets(void);
+#endif
+static struct tcb *semaphore_post(int32_t *p_sema);
+static void tcb_init(struct tcb *p_tcb, void (*p_task)(void), 
+	uint8_t priority, uint32_t *p_stack_top);
+static int32_t add_task(void (*p_task)(void), uint8_t priority, 
+	uint32_t *p_stack_top);
+static void idle_task(void);
 static void real_time_events(void);
+#if OS_CFG_TICK_UNIFIED
+static bool other_task_ready(void);
+#endif
+#if OS_CFG_RTC
+static void rtc_task(void);
+static bool rtc_can_run(const struct tcb *p_tcb, const struct tcb *p_top);
+static struct tcb *rtc_top(void);
+static void rtc_switch(struct tcb *p_next);
+#endif
+#if OS_CFG_HRTIMER
+static void hr_arm(uint64_t now);
+#endif
+#if OS_CFG_EDF
+static bool edf_before(const struct tcb *p_a, const struct tcb *p_b);
+static void edf_swap(uint8_t i, uint8_t j);
+static void edf_sift(uint8_t i);
+static void edf_insert(struct tcb *p_tcb);
+static void edf_remove(struct tcb *p_tcb);
+static void edf_release(struct tcb *p_tcb, uint32_t deadline);
+#endif
+#if OS_CFG_TIMER
+static void timer_insert(struct os_timer *p_timer);
+static void timer_remove(struct os_timer *p_timer);
+static void timer_task(void);
+#endif
+#if OS_CFG_IRQ_OFF_TRACK
+static void irq_off_enter(const char *p_func, uint16_t line);
+static void irq_off_exit(void);
+#endif
 
 //*****************************************************************************
 //
@@ -127,38 +454,62 @@ static void real_time_events(void);
 //*****************************************************************************
 //*****************************************************************************
 //
-//! @brief Set the initial stack of a task.
+//! @brief Convert milliseconds to ticks.
+//!
+//! This function rounds up, so a nonzero time is at least one tick. The 
+//! rates that are a multiple of 1 kHz take a single multiply.
+//!
+//! @param[in] ms Time in ms.
+//!
+//! @return Time in ticks of the current rate.
+//
+//*****************************************************************************
+static uint32_t ms_to_ticks(uint32_t ms)
+{
+	uint32_t freq = g_tick_freq;
+
+	if((freq % 1000) == 0)
+	{
+		return ms * (freq / 1000);
+	}
+	return (uint32_t)(((uint64_t)ms * freq + 999) / 1000);
+}
+
+//*****************************************************************************
+//
+//! @brief Convert a number of ticks to another tick rate.
+//!
+//! @param[in] ticks Time in ticks of the rate from.
+//! @param[in] from Old tick rate (Hz).
+//! @param[in] to New tick rate (Hz).
+//!
+//! @return Time in ticks of the rate to, rounded up.
+//
+//*****************************************************************************
+static uint32_t tick_rescale(uint32_t ticks, uint32_t from, uint32_t to)
+{
+	return (uint32_t)(((uint64_t)ticks * to + from - 1) / from);
+}
+
+//*****************************************************************************
+//
+//! @brief Start a new time slice.
 //!
-//! @param[in] task .
+//! @param[in] p_tcb Task that is given the CPU.
 //!
 //! @return None.
 //
 //*****************************************************************************
-static void init_task_stack(uint8_t task)
+static void slice_reload(struct tcb *p_tcb)
 {
-	g_tcbs[task].sp = &g_stacks[task][STACK_SIZE-16]; // task stack pointer
-	g_stacks[task][STACK_SIZE-1] = 0x01000000;     // thumb bit
-	g_stacks[task][STACK_SIZE-3] = 0x14141414;     // R14
-	g_stacks[task][STACK_SIZE-4] = 0x12121212;     // R12
-	g_stacks[task][STACK_SIZE-5] = 0x03030303;     // R3
-	g_stacks[task][STACK_SIZE-6] = 0x02020202;     // R2
-	g_stacks[task][STACK_SIZE-7] = 0x01010101;     // R1
-	g_stacks[task][STACK_SIZE-8] = 0x00000000;     // R0
-	g_stacks[task][STACK_SIZE-9] = 0x11111111;     // R11
-	g_stacks[task][STACK_SIZE-10] = 0x10101010;    // R10
-	g_stacks[task][STACK_SIZE-11] = 0x09090909;    // R9
-	g_stacks[task][STACK_SIZE-12] = 0x08080808;    // R8
-	g_stacks[task][STACK_SIZE-13] = 0x07070707;    // R7
-	g_stacks[task][STACK_SIZE-14] = 0x06060606;    // R6
-	g_stacks[task][STACK_SIZE-15] = 0x05050505;    // R5
-	g_stacks[task][STACK_SIZE-16] = 0x04040404;    // R4
+	p_tcb->slice = p_tcb->quantum ? ms_to_ticks(p_tcb->quantum) : 1;
 }
 
 //*****************************************************************************
 //
 //! @brief Update sleep time.
 //!
-//! This function decreases the sleep time of sleeping tasks by one ms.
+//! This function decreases the sleep time of sleeping tasks by one tick.
 //!
 //! @return None.
 //
@@ -171,220 +522,1757 @@ static void update_sleep_time(void)
 		if (g_tcbs[i].sleep)
 		{
 			g_tcbs[i].sleep--;
+			if(g_tcbs[i].sleep == 0)
+			{
+				TRACE(TRACE_WAKE, i, 0);
+				WAKE_STAMP(&g_tcbs[i]);
+				EDF_READY(&g_tcbs[i]);
+			}
 		}
 	}
 }
 
+#if OS_CFG_BUDGET
 //*****************************************************************************
 //
-//! @brief Run periodic events.
+//! @brief Charge the tick to the running task and replenish the budgets.
 //!
-//! This function handles all the periodic events added by the user, in
-//! addition to the internal event to update the sleep time of all tasks.
+//! This function implements a deferrable server per task: the budget is 
+//! restored in full at the start of every period, and a task that used it 
+//! up is suspended (or demoted) for the rest of the period. With OS_CFG_EDF
+//! a demoted task is suspended as well, since its deadline would still 
+//! come first.
 //!
 //! @return None.
 //
 //*****************************************************************************
-static void real_time_events(void)
+static void update_budgets(void)
 {
+	struct tcb *p_tcb = gp_running_task;
+	uint32_t tick_us = g_tick_us;
 	uint8_t i;
-	bool call_scheduler = false;
-	static uint32_t millis = 0;
-
-	update_sleep_time();
 
-	if(++millis)
+	if(p_tcb->budget && (p_tcb->blocked == 0) && (p_tcb->sleep == 0) &&
+		(p_tcb->budget_used < p_tcb->budget))
 	{
-		for (i = 0; i < NUM_EVENTS; i++)
+		p_tcb->budget_used += tick_us;
+		if(p_tcb->budget_used >= p_tcb->budget)
 		{
-			// only nonzero periods 
-			if(g_ecbs[i].period)
+			// out of budget until the replenishment
+#if !OS_CFG_EDF
+			if(p_tcb->budget_demote)
 			{
-				if((millis % g_ecbs[i].period) == 0)
-				{
-					// signal the event semaphore so that
-					// the task linked to it can run
-					OS_Semaphore_post(g_ecbs[i].semaphore);
-					call_scheduler = true;
-				}
+				p_tcb->priority = BUDGET_PRIORITY;
+				p_tcb->threshold = BUDGET_PRIORITY;
+			}
+			else
+#endif
+			{
+				p_tcb->blocked = &g_budget_wait;
+				EDF_UNREADY(p_tcb);
+				TRACE(TRACE_BLOCK, TASK_ID(p_tcb), &g_budget_wait);
 			}
+			SysTick_set_pending();
 		}
+	}
 
-		// if an event has to run, call the scheduler
-		if(call_scheduler)
+	for (i = 0; i < g_task_cnt; i++)
+	{
+		p_tcb = &g_tcbs[i];
+		if(p_tcb->budget == 0)
+		{
+			continue;
+		}
+		if(p_tcb->budget_next > tick_us)
+		{
+			p_tcb->budget_next -= tick_us;
+			continue;
+		}
+		// start of a new period, with the full budget
+		p_tcb->budget_next += p_tcb->budget_period - tick_us;
+		p_tcb->budget_used = 0;
+		p_tcb->priority = p_tcb->base_priority;
+		p_tcb->threshold = p_tcb->base_threshold;
+		if(p_tcb->blocked == &g_budget_wait)
 		{
-			OS_suspend();
+			p_tcb->blocked = 0;
+			TRACE(TRACE_WAKE, i, &g_budget_wait);
+			WAKE_STAMP(p_tcb);
+			EDF_READY(p_tcb);
 		}
 	}
 }
+#endif
 
 //*****************************************************************************
 //
-//! @brief Scheduling algorithm.
+//! @brief Switch to a new tick rate.
 //!
-//! This fucntion runs once every time slice to choose the next process to run.
-//! The scheduler uses a Fixed Priority algorithm to decide which task runs 
-//! next. Calling function of the scheduler is inside of the SysTick_Handler
-//! which was defined in the "osasm.s" file.
+//! This function rescales everything counted in ticks, so that the sleeps, 
+//! the periodic events and the software timers keep their length in time. 
+//! Once the kernel runs, it is called from WideTimer5A_Handler, right after 
+//! a tick, and the wide timer 5A and the SysTick are reprogrammed. Their 
+//! counters restart, so the new rate counts from the reprogramming.
+//!
+//! @param[in] freq New tick rate (Hz), checked by OS_set_tick_freq().
 //!
 //! @return None.
 //
 //*****************************************************************************
-void scheduler(void)
+static void tick_rate_apply(uint32_t freq)
 {
-	uint8_t max = 255;
-	struct tcb *tmp;
-	struct tcb *bst_task;
-  	
-	tmp = gp_running_task;
+	uint32_t i, old = g_tick_freq;
+#if OS_CFG_TIMER
+	struct os_timer *p_timer, *p_next, *p_list = 0;
+#endif
 
-	// search for highest priority task that is not blocked or sleeping
-	do
+	g_tick_freq = freq;
+	g_tick_us = 1000000 / freq;
+
+	for (i = 0; i < g_task_cnt; i++)
 	{
-		// move through the tasks available
-		tmp = tmp->next;
-		if((tmp->priority < max) && ((tmp->blocked) == 0) && ((tmp->sleep) == 0))
+		if(g_tcbs[i].sleep)
 		{
-			// keep track of the highest priority task 
-			max = tmp->priority;
-			bst_task = tmp;
+			g_tcbs[i].sleep = tick_rescale(g_tcbs[i].sleep, old, freq);
 		}
-	} while(gp_running_task != tmp);
+#if OS_CFG_EDF
+		if((int32_t)(g_tcbs[i].deadline - g_ticks_lo) > 0)
+		{
+			g_tcbs[i].deadline = g_ticks_lo + tick_rescale(
+				g_tcbs[i].deadline - g_ticks_lo, old, freq);
+		}
+#endif
+	}
+#if OS_CFG_EDF
+	// the rounding may turn two deadlines into a tie, broken by priority, 
+	// so the heap is built again
+	g_edf_cnt = 0;
+	for (i = 0; i < g_task_cnt; i++)
+	{
+		if(g_tcbs[i].heap_idx != EDF_NONE)
+		{
+			g_tcbs[i].heap_idx = EDF_NONE;
+			edf_insert(&g_tcbs[i]);
+		}
+	}
+#if OS_CFG_TIMER
+	if(TIMER_TASK->heap_idx != EDF_NONE)
+	{
+		TIMER_TASK->heap_idx = EDF_NONE;
+		edf_insert(TIMER_TASK);
+	}
+#endif
+#endif
+	for (i = 0; i < g_event_cnt; i++)
+	{
+		g_ecbs[i].period = ms_to_ticks(g_ecbs[i].period_ms);
+	}
 
-	gp_running_task = bst_task;
+#if OS_CFG_TIMER
+	// take out the timers that are not due yet (the others are left to the
+	// service task) and put them back at their new expiry tick
+	for (i = 0; i < OS_CFG_TIMER_WHEEL; i++)
+	{
+		for (p_timer = gp_wheel[i]; p_timer; p_timer = p_next)
+		{
+			p_next = p_timer->p_next;
+			if((int32_t)(p_timer->expiry - g_ticks_lo) > 0)
+			{
+				timer_remove(p_timer);
+				p_timer->expiry = g_ticks_lo + tick_rescale(
+					p_timer->expiry - g_ticks_lo, old, freq);
+				p_timer->p_next = p_list;
+				p_list = p_timer;
+			}
+		}
+	}
+	for (p_timer = p_list; p_timer; p_timer = p_next)
+	{
+		p_next = p_timer->p_next;
+		timer_insert(p_timer);
+	}
+#endif
+
+	if(g_tick_period)
+	{
+		// the counter restarts from the new period, so the time since the
+		// tick is added to the system time first (less than 1 us is lost)
+		g_time_us += (g_tick_period - 1 - Timer_WTimer5A_get_count()) / 
+			(CPU_CLOCK_FREQ / 1000000);
+		g_tick_period = CPU_CLOCK_FREQ / freq;
+		Timer_WTimer5A_set_period(g_tick_period);
+#if !OS_CFG_TICK_UNIFIED
+		SysTick_init(g_tick_period, true, 7);
+#endif
+	}
 }
 
 //*****************************************************************************
 //
-//  Functions for the API.
+//! @brief Signal a semaphore.
+//!
+//! This function is the body of OS_Semaphore_post(), for the kernel code 
+//! that runs with interrupts disabled already.
+//!
+//! @param[in] p_sema Pointer to an initialized semaphore.
+//!
+//! @return The task unblocked, NULL if none.
 //
 //*****************************************************************************
+static struct tcb *semaphore_post(int32_t *p_sema)
+{
+	struct tcb *tmp;
+
+	(*p_sema) = (*p_sema) + 1;
+	TRACE(TRACE_POST, TASK_ID(gp_running_task), p_sema);
+	
+	// if there is a task blocked on this semaphore,
+	// then find it and unblock it
+	if((*p_sema) > 0)
+	{
+		return 0;
+	}
+	tmp = gp_running_task->next;
+	while(tmp->blocked != p_sema)
+	{
+		tmp = tmp->next;
+	}
+	// unblock task
+	tmp->blocked = 0; 
+	TRACE(TRACE_UNBLOCK, TASK_ID(tmp), p_sema);
+	WAKE_STAMP(tmp);
+	EDF_READY(tmp);
+#if OS_CFG_POST_PREEMPT
+	// preempt the running task (or the task interrupted by the ISR) 
+	// instead of waiting for the end of its time slice
+	if(PREEMPTS(tmp, gp_running_task))
+	{
+		SysTick_set_pending();
+	}
+#endif
+	return tmp;
+}
+
+#if OS_CFG_RTC
 //*****************************************************************************
 //
-//! @brief Start OS kernel.
+//! @brief Body of the run-to-completion tasks.
 //!
-//! This function initializes the required hardware components of the TM4C123G 
-//! to run the OS kernel.
+//! A run-to-completion task is started on the shared stack with this 
+//! function, which calls its job once per signal of its semaphore. While 
+//! there are signals left, the next job is a plain call on the same stack.
+//! Once the task blocks, it is done and gives the stack back (see 
+//! rtc_switch).
 //!
 //! @return None.
 //
 //*****************************************************************************
-void OS_start(void)
+static void rtc_task(void)
 {
-	uint32_t i, time_slice, events_period;
-	const struct ecb ecb_default = 
+	struct tcb *p_tcb = gp_running_task;
+
+	while(1)
 	{
-		.semaphore = 0, 
-		.period = 0
-	};
+		p_tcb->p_job();
+		p_tcb->rtc_state = RTC_DONE;
+		OS_Semaphore_pend(p_tcb->p_job_sema);
+		p_tcb->rtc_state = RTC_RUN;
+	}
+}
 
-	// allowed period of time to run per task 
-	time_slice = CPU_CLOCK_FREQ/TASK_FREQ;
-	// running period for the real-time events
-	events_period = CPU_CLOCK_FREQ/EVENT_FREQ;
+//*****************************************************************************
+//
+//! @brief Check if the shared stack lets a task run.
+//!
+//! @param[in] p_tcb Pointer to the task.
+//! @param[in] p_top Last run-to-completion task started (NULL if none).
+//!
+//! @return True for a task with its own stack, for the task on top of the 
+//!         shared stack and for a task that may start above it.
+//
+//*****************************************************************************
+static bool rtc_can_run(const struct tcb *p_tcb, const struct tcb *p_top)
+{
+	if(p_tcb->p_job == 0)
+	{
+		return true;
+	}
+	if(p_tcb->rtc_state != RTC_IDLE)
+	{
+		return p_tcb == p_top;
+	}
+	return (p_top == 0) || (p_tcb->priority < p_top->priority);
+}
 
-	// disable interrupts
-	CPU_disable_irq();
-	// run CPU at 80 MHz			
-	PLL_init();
-	
-	// enable wide timer 5 interrupt (WideTimer5A_Handler)
-	// highest priority (0), period of interruption 1 ms 
-	Timer_WTimer5A_init(events_period, 0);
-	
-	// enable system tick interrupt (SysTick_Handler)
-	// lowest priority (7), period of interruption 1 ms  
-	SysTick_init(time_slice, true, 7);
-	
-	// task 0 runs first
-	gp_running_task = &g_tcbs[0]; 
-	// uninitialized events are set with a default confing
-	for (i = g_event_cnt; i < NUM_EVENTS; ++i)
+//*****************************************************************************
+//
+//! @brief Get the top of the shared stack once the running task is out.
+//!
+//! @return gp_rtc_top, or the task below it if the running task is done.
+//
+//*****************************************************************************
+static struct tcb *rtc_top(void)
+{
+	if((gp_running_task->rtc_state == RTC_DONE) && gp_running_task->blocked)
+	{
+		return gp_running_task->rtc_prev;
+	}
+	return gp_rtc_top;
+}
+
+//*****************************************************************************
+//
+//! @brief Update the shared stack on a switch of tasks.
+//!
+//! This function runs in the scheduler, after the context of the running 
+//! task is saved. A done task leaves the shared stack, and a task that is
+//! not started gets a new frame right below the saved context of the top
+//! one (or at the top of g_rtc_stack). Its earlier context, if any, is 
+//! dropped. The handler and the scheduler run on the stack of the task
+//! switched out, so if that one stays on top, the frame goes below them
+//! instead (see CPU_restart_stack).
+//!
+//! @param[in] p_next Pointer to the task that runs next.
+//!
+//! @return None.
+//
+//*****************************************************************************
+static void rtc_switch(struct tcb *p_next)
+{
+	struct tcb *p_top = rtc_top();
+	uint32_t *p_stack_top;
+
+	if(p_top != gp_rtc_top)
+	{
+		gp_running_task->rtc_state = RTC_IDLE;
+		gp_rtc_top = p_top;
+	}
+	if((p_next->p_job != 0) && (p_next->rtc_state == RTC_IDLE))
+	{
+		if(p_top == 0)
+		{
+			p_stack_top = &g_rtc_stack[OS_CFG_RTC_STACK_SIZE];
+		}
+		else if(p_top == gp_running_task)
+		{
+			p_stack_top = 0;			// below the live handler frames
+		}
+		else
+		{
+			p_stack_top = p_top->sp;
+		}
+		p_next->sp = CPU_restart_stack(p_next->sp, p_stack_top, rtc_task);
+		p_next->rtc_state = RTC_RUN;
+		p_next->rtc_prev = p_top;
+		gp_rtc_top = p_next;
+	}
+}
+#endif
+
+#if OS_CFG_TICK_UNIFIED
+//*****************************************************************************
+//
+//! @brief Check if the scheduler would switch tasks.
+//!
+//! This function looks for a task, other than the running one, that is 
+//! ready and has a higher priority, or the same priority once the time 
+//! slice of the running task is over. The scheduler would pick it (round 
+//! robin among equal priorities), so the running task must be switched out.
+//!
+//! @return True if such a task exists.
+//
+//*****************************************************************************
+static bool other_task_ready(void)
+{
+#if OS_CFG_EDF
+	// the root of the heap runs next (see scheduler)
+	if((gp_running_task->slice == 0) && g_edf_cnt && 
+		(gp_edf_heap[0] == gp_running_task))
+	{
+		edf_remove(gp_running_task);
+		edf_insert(gp_running_task);
+	}
+	return g_edf_cnt && (gp_edf_heap[0] != gp_running_task);
+#else
+	struct tcb *tmp = gp_running_task->next;
+	uint8_t max = gp_running_task->priority;
+
+	// a task of the same priority waits for the end of the time slice
+	if((gp_running_task->slice == 0) && (max < IDLE_PRIORITY))
+	{
+		max++;
+	}
+	// and a task up to the preemption threshold waits for the running one
+	if(gp_running_task->threshold < gp_running_task->priority)
+	{
+		max = gp_running_task->threshold;
+	}
+	for (; tmp != gp_running_task; tmp = tmp->next)
+	{
+		if((tmp->priority < max) && (tmp->blocked == 0) && 
+			(tmp->sleep == 0) && RTC_CAN_RUN(tmp, gp_rtc_top))
+		{
+			return true;
+		}
+	}
+	return false;
+#endif
+}
+#endif
+
+#if OS_CFG_IRQ_OFF_TRACK
+//*****************************************************************************
+//
+//! @brief Start timing a critical section.
+//!
+//! This function runs with interrupts disabled, right after they were.
+//!
+//! @param[in] p_func Name of the kernel function.
+//! @param[in] line Line of the critical section in "os.c".
+//!
+//! @return None.
+//
+//*****************************************************************************
+static void irq_off_enter(const char *p_func, uint16_t line)
+{
+	gp_irq_off_func = p_func;
+	g_irq_off_line = line;
+	g_irq_off_stamp = DWT_get_cycles();
+}
+
+//*****************************************************************************
+//
+//! @brief Stop timing a critical section.
+//!
+//! This function runs with interrupts disabled, right before they are 
+//! enabled again. An exit without an entry (interrupts already enabled) is 
+//! ignored.
+//!
+//! @return None.
+//
+//*****************************************************************************
+static void irq_off_exit(void)
+{
+	uint32_t cycles;
+
+	if(gp_irq_off_func == 0)
+	{
+		return;
+	}
+	cycles = DWT_get_cycles() - g_irq_off_stamp;
+
+	g_irq_off.count++;
+	if(cycles > g_irq_off.max_cycles)
+	{
+		g_irq_off.max_cycles = cycles;
+		g_irq_off.p_func = gp_irq_off_func;
+		g_irq_off.line = g_irq_off_line;
+	}
+#if OS_CFG_HIST
+	Hist_record(&g_hist_irq_off, cycles);
+#endif
+	gp_irq_off_func = 0;
+}
+#endif
+
+//*****************************************************************************
+//
+//! @brief Run periodic events.
+//!
+//! This function handles all the periodic events added by the user, in
+//! addition to the internal event to update the sleep time of all tasks.
+//!
+//! @return None.
+//
+//*****************************************************************************
+static void real_time_events(void)
+{
+	uint8_t i;
+	bool call_scheduler = false;
+	uint32_t ticks;
+#if OS_CFG_EDF
+	struct tcb *p_tcb;
+#endif
+
+	update_sleep_time();
+	// the running task has used one more tick of its time slice
+	if(gp_running_task->slice)
+	{
+		gp_running_task->slice--;
+	}
+#if OS_CFG_BUDGET
+	// and of its CPU budget
+	update_budgets();
+#endif
+
+	// advance the system time (readers are preempted by this handler, but
+	// never the other way around, see OS_time_ticks)
+	g_time_us += g_tick_us;
+	ticks = g_ticks_lo + 1;
+	if(ticks == 0)
+	{
+		g_ticks_hi++;
+	}
+	g_ticks_lo = ticks;
+
+	// a new tick rate starts in the handler of a tick (see tick_rate_apply)
+	if(g_tick_freq_next)
+	{
+		tick_rate_apply(g_tick_freq_next);
+		g_tick_freq_next = 0;
+	}
+
+	if(ticks)
+	{
+		for (i = 0; i < NUM_EVENTS; i++)
+		{
+			// only nonzero periods 
+			if(g_ecbs[i].period)
+			{
+				if((ticks % g_ecbs[i].period) == 0)
+				{
+					// signal the event semaphore so that
+					// the task linked to it can run
+#if OS_CFG_EDF
+					// (a new job, due at the next release)
+					p_tcb = semaphore_post(g_ecbs[i].semaphore);
+					if(p_tcb)
+					{
+						edf_release(p_tcb, ticks + g_ecbs[i].period);
+					}
+#else
+					OS_Semaphore_post(g_ecbs[i].semaphore);
+#endif
+					call_scheduler = true;
+				}
+			}
+		}
+
+#if OS_CFG_TIMER
+		// wake the timer service task if a timer may expire now
+		if(gp_wheel[TIMER_SLOT(ticks)])
+		{
+			OS_Semaphore_post(&g_timer_sema);
+			call_scheduler = true;
+		}
+#endif
+
+#if OS_CFG_TICK_UNIFIED
+		// the tick also counts the time slices, but the scheduler runs only
+		// if it would switch tasks: a task woken or posted above, or another
+		// one ready at the same priority once the slice is over
+		call_scheduler = other_task_ready();
+#endif
+
+		// if an event has to run, call the scheduler (the running task 
+		// is preempted, so OS_suspend() is not used here)
+		if(call_scheduler)
+		{
+			SysTick_set_pending();
+		}
+	}
+}
+
+#if OS_CFG_HRTIMER
+//*****************************************************************************
+//
+//! @brief Arm the one-shot timer for the next high-resolution wake.
+//!
+//! This function programs the wide timer 3A with the time left to the wake 
+//! of the first sleeping task. A wake time that has already passed fires 
+//! right away. Interrupts must be disabled (or called from the handler).
+//!
+//! @param[in] now Current time (OS_time_us).
+//!
+//! @return None.
+//
+//*****************************************************************************
+static void hr_arm(uint64_t now)
+{
+	uint64_t delta;
+
+	if(gp_hr_head == 0)
+	{
+		return;
+	}
+	delta = gp_hr_head->hr_wake > now ? gp_hr_head->hr_wake - now : 0;
+	// saturate to the 32-bit counter (~53 s at 80 MHz), the handler re-arms
+	if(delta > UINT32_MAX / (CPU_CLOCK_FREQ / 1000000))
+	{
+		delta = UINT32_MAX / (CPU_CLOCK_FREQ / 1000000);
+	}
+	Timer_WTimer3A_start(delta ? (uint32_t)delta * (CPU_CLOCK_FREQ / 1000000) 
+		: 1);
+}
+#endif
+
+#if OS_CFG_EDF
+//*****************************************************************************
+//
+//! @brief Compare two tasks for the EDF scheduling.
+//!
+//! The earlier deadline goes first (modulo 2^32 ticks), then a task with a
+//! deadline before one without, and the priority breaks the ties.
+//!
+//! @param[in] p_a First task.
+//! @param[in] p_b Second task.
+//!
+//! @return True if p_a must run before p_b.
+//
+//*****************************************************************************
+static bool edf_before(const struct tcb *p_a, const struct tcb *p_b)
+{
+	if(p_a->has_deadline != p_b->has_deadline)
+	{
+		return p_a->has_deadline;
+	}
+	if(p_a->has_deadline && (p_a->deadline != p_b->deadline))
+	{
+		return (int32_t)(p_a->deadline - p_b->deadline) < 0;
+	}
+	return p_a->priority < p_b->priority;
+}
+
+//*****************************************************************************
+//
+//! @brief Swap two entries of the ready heap.
+//!
+//! @param[in] i Index of the first entry.
+//! @param[in] j Index of the second entry.
+//!
+//! @return None.
+//
+//*****************************************************************************
+static void edf_swap(uint8_t i, uint8_t j)
+{
+	struct tcb *tmp = gp_edf_heap[i];
+
+	gp_edf_heap[i] = gp_edf_heap[j];
+	gp_edf_heap[j] = tmp;
+	gp_edf_heap[i]->heap_idx = i;
+	gp_edf_heap[j]->heap_idx = j;
+}
+
+//*****************************************************************************
+//
+//! @brief Restore the order of the ready heap around one entry.
+//!
+//! This function moves an entry whose deadline changed, or that was just 
+//! put in place, up or down to where it belongs. Interrupts must be 
+//! disabled (or called from a kernel handler).
+//!
+//! @param[in] i Index of the entry.
+//!
+//! @return None.
+//
+//*****************************************************************************
+static void edf_sift(uint8_t i)
+{
+	uint8_t child;
+
+	while(i && edf_before(gp_edf_heap[i], gp_edf_heap[(i - 1) / 2]))
+	{
+		edf_swap(i, (i - 1) / 2);
+		i = (i - 1) / 2;
+	}
+	while(1)
+	{
+		child = 2 * i + 1;
+		if(child >= g_edf_cnt)
+		{
+			break;
+		}
+		if((child + 1 < g_edf_cnt) && 
+			edf_before(gp_edf_heap[child + 1], gp_edf_heap[child]))
+		{
+			child++;
+		}
+		if(!edf_before(gp_edf_heap[child], gp_edf_heap[i]))
+		{
+			break;
+		}
+		edf_swap(i, child);
+		i = child;
+	}
+}
+
+//*****************************************************************************
+//
+//! @brief Add a task made ready to the heap.
+//!
+//! A task already in the heap is left as is. Interrupts must be disabled.
+//!
+//! @param[in] p_tcb Task that is not blocked nor sleeping.
+//!
+//! @return None.
+//
+//*****************************************************************************
+static void edf_insert(struct tcb *p_tcb)
+{
+	if(p_tcb->heap_idx != EDF_NONE)
+	{
+		return;
+	}
+	p_tcb->heap_idx = g_edf_cnt;
+	gp_edf_heap[g_edf_cnt++] = p_tcb;
+	edf_sift(p_tcb->heap_idx);
+}
+
+//*****************************************************************************
+//
+//! @brief Take a task that blocks or sleeps out of the heap.
+//!
+//! A task that is not in the heap is ignored. Interrupts must be disabled.
+//!
+//! @param[in] p_tcb Task that is no longer ready.
+//!
+//! @return None.
+//
+//*****************************************************************************
+static void edf_remove(struct tcb *p_tcb)
+{
+	uint8_t i = p_tcb->heap_idx;
+
+	if(i == EDF_NONE)
+	{
+		return;
+	}
+	p_tcb->heap_idx = EDF_NONE;
+	g_edf_cnt--;
+	// the last entry fills the hole
+	if(i != g_edf_cnt)
+	{
+		gp_edf_heap[i] = gp_edf_heap[g_edf_cnt];
+		gp_edf_heap[i]->heap_idx = i;
+		edf_sift(i);
+	}
+}
+
+//*****************************************************************************
+//
+//! @brief Give a task a new absolute deadline.
+//!
+//! Interrupts must be disabled.
+//!
+//! @param[in] p_tcb Task released for a new job.
+//! @param[in] deadline Tick by which the job must be done.
+//!
+//! @return None.
+//
+//*****************************************************************************
+static void edf_release(struct tcb *p_tcb, uint32_t deadline)
+{
+	p_tcb->deadline = deadline;
+	p_tcb->has_deadline = 1;
+	if(p_tcb->heap_idx != EDF_NONE)
+	{
+		edf_sift(p_tcb->heap_idx);
+	}
+}
+#endif
+
+#if OS_CFG_TIMER
+//*****************************************************************************
+//
+//! @brief Insert a timer in the slot of its expiry tick.
+//!
+//! Interrupts must be disabled.
+//!
+//! @param[in] p_timer Timer with the expiry set.
+//!
+//! @return None.
+//
+//*****************************************************************************
+static void timer_insert(struct os_timer *p_timer)
+{
+	struct os_timer **pp_slot = &gp_wheel[TIMER_SLOT(p_timer->expiry)];
+
+	p_timer->p_prev = 0;
+	p_timer->p_next = *pp_slot;
+	if(*pp_slot)
+	{
+		(*pp_slot)->p_prev = p_timer;
+	}
+	*pp_slot = p_timer;
+	p_timer->active = 1;
+}
+
+//*****************************************************************************
+//
+//! @brief Remove a timer from its slot.
+//!
+//! Interrupts must be disabled.
+//!
+//! @param[in] p_timer Active timer.
+//!
+//! @return None.
+//
+//*****************************************************************************
+static void timer_remove(struct os_timer *p_timer)
+{
+	if(p_timer->p_prev)
+	{
+		p_timer->p_prev->p_next = p_timer->p_next;
+	}
+	else
+	{
+		gp_wheel[TIMER_SLOT(p_timer->expiry)] = p_timer->p_next;
+	}
+	if(p_timer->p_next)
+	{
+		p_timer->p_next->p_prev = p_timer->p_prev;
+	}
+	p_timer->active = 0;
+}
+
+//*****************************************************************************
+//
+//! @brief Timer service task.
+//!
+//! This task runs the ticks posted by WideTimer5A_Handler, catching up if it
+//! was delayed. For each tick, the expired timers of its slot (the others 
+//! expire on a later turn of the wheel) are taken out one by one, re-armed
+//! if periodic, and their callback is run with interrupts enabled. So a 
+//! callback may start or stop any timer, including its own.
+//!
+//! @return None.
+//
+//*****************************************************************************
+static void timer_task(void)
+{
+	struct os_timer *p_timer;
+	void (*p_callback)(void *p_arg);
+	void *p_arg;
+
+	while(1)
+	{
+		OS_Semaphore_pend(&g_timer_sema);
+		while(g_timer_tick != g_ticks_lo)
+		{
+			g_timer_tick++;
+			while(1)
+			{
+				IRQ_DISABLE();
+				p_timer = gp_wheel[TIMER_SLOT(g_timer_tick)];
+				while(p_timer && p_timer->expiry != g_timer_tick)
+				{
+					p_timer = p_timer->p_next;
+				}
+				if(p_timer == 0)
+				{
+					IRQ_ENABLE();
+					break;
+				}
+				timer_remove(p_timer);
+				if(p_timer->period)
+				{
+					p_timer->expiry += ms_to_ticks(p_timer->period);
+					timer_insert(p_timer);
+				}
+				p_callback = p_timer->p_callback;
+				p_arg = p_timer->p_arg;
+				IRQ_ENABLE();
+				p_callback(p_arg);
+			}
+		}
+	}
+}
+#endif
+
+//*****************************************************************************
+//
+//! @brief Idle task.
+//!
+//! The scheduler runs this task when no other task is ready, so a blocked 
+//! or sleeping task never keeps the CPU. It sleeps until the next interrupt.
+//
+//*****************************************************************************
+static void idle_task(void)
+{
+	while(1)
+	{
+		CPU_wait_irq();
+	}
+}
+
+//*****************************************************************************
+//
+//! @brief Scheduling algorithm.
+//!
+//! This fucntion runs once every time slice to choose the next process to run.
+//! The scheduler uses a Fixed Priority algorithm to decide which task runs 
+//! next. Tasks of equal priority take turns, each one keeping the CPU for 
+//! its quantum (OS_set_task_quantum) unless it blocks, sleeps or yields.
+//! With OS_CFG_EDF, the task with the earliest deadline runs instead. When
+//! no task is ready, the idle task runs.
+//! Calling function of the scheduler is inside of the SysTick_Handler
+//! which was defined in the "osasm.s" file.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void scheduler(void)
+{
+#if !OS_CFG_EDF
+	uint8_t max = 255;
+	struct tcb *tmp;
+#endif
+#if OS_CFG_RTC
+	struct tcb *p_top = rtc_top();	// shared stack without a done task
+#endif
+	struct tcb *bst_task = IDLE_TASK;	// kept if no task is ready
+#if OS_CFG_HIST
+	uint32_t start = DWT_get_cycles();
+#endif
+#if OS_CFG_IRQ_OFF_TRACK
+	// SysTick_Handler disables the interrupts around the scheduler (the 
+	// register save and restore are not included)
+	irq_off_enter(__func__, __LINE__);
+#endif
+#if OS_CFG_TASK_STATS
+	uint32_t now;
+
+	// charge the running task with the cycles since the last switch
+	now = DWT_get_cycles();
+	gp_running_task->cycles += (uint32_t)(now - g_switch_stamp);
+	g_switch_stamp = now;
+#endif
+  	
+#if OS_CFG_EDF
+	// at the end of its time slice, the running task goes behind the ready
+	// tasks with the same deadline (or without one, and the same priority)
+	if((gp_running_task->slice == 0) && g_edf_cnt && 
+		(gp_edf_heap[0] == gp_running_task))
+	{
+		edf_remove(gp_running_task);
+		edf_insert(gp_running_task);
+	}
+	// the ready task with the earliest deadline
+	if(g_edf_cnt)
+	{
+		bst_task = gp_edf_heap[0];
+	}
+#else
+	tmp = gp_running_task;
+	// within its time slice, the running task is only preempted by a task
+	// of higher priority, and at any time only by a task above its 
+	// preemption threshold, unless it gives up the CPU
+	if((gp_running_task->blocked == 0) && (gp_running_task->sleep == 0) &&
+		!g_yield)
+	{
+		bst_task = gp_running_task;
+		if(gp_running_task->slice)
+		{
+			max = gp_running_task->priority;
+		}
+		if(gp_running_task->threshold < gp_running_task->priority)
+		{
+			max = gp_running_task->threshold;
+		}
+	}
+
+	// search for highest priority task that is not blocked or sleeping
+	do
+	{
+		// move through the tasks available
+		tmp = tmp->next;
+		if((tmp->priority < max) && ((tmp->blocked) == 0) && 
+			((tmp->sleep) == 0) && RTC_CAN_RUN(tmp, p_top))
+		{
+			// keep track of the highest priority task 
+			max = tmp->priority;
+			bst_task = tmp;
+		}
+	} while(gp_running_task != tmp);
+#endif
+
+	if(bst_task != gp_running_task)
+	{
+		TRACE(TRACE_SWITCH, TASK_ID(bst_task), TASK_ID(gp_running_task));
+#if OS_CFG_RTC
+		rtc_switch(bst_task);
+#endif
+#if OS_CFG_TASK_STATS
+		if(g_yield)
+		{
+			gp_running_task->yields++;
+		}
+		else
+		{
+			gp_running_task->preemptions++;
+		}
+#endif
+	}
+	if((bst_task != gp_running_task) || (bst_task->slice == 0))
+	{
+		slice_reload(bst_task);
+	}
+	g_yield = false;
+#if OS_CFG_HIST
+	if(bst_task->wake_stamp)
+	{
+		Hist_record(&g_hist_wake, DWT_get_cycles() - bst_task->wake_stamp);
+		bst_task->wake_stamp = 0;
+	}
+	Hist_record(&g_hist_sched, DWT_get_cycles() - start);
+#endif
+
+	gp_running_task = bst_task;
+#if OS_CFG_IRQ_OFF_TRACK
+	irq_off_exit();
+#endif
+}
+
+//*****************************************************************************
+//
+//  Functions for the API.
+//
+//*****************************************************************************
+//*****************************************************************************
+//
+//! @brief Start OS kernel.
+//!
+//! This function initializes the required hardware components of the TM4C123G 
+//! to run the OS kernel.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void OS_start(void)
+{
+	uint32_t i, time_slice, events_period;
+	const struct ecb ecb_default = 
+	{
+		.semaphore = 0, 
+		.period = 0,
+		.period_ms = 0
+	};
+
+	// allowed period of time to run per task (one tick, a task runs for 
+	// one or more of them, see OS_set_task_quantum)
+	time_slice = CPU_CLOCK_FREQ/g_tick_freq;
+	// running period for the real-time events
+	events_period = CPU_CLOCK_FREQ/g_tick_freq;
+
+	// disable interrupts
+	CPU_disable_irq();
+	// run CPU at 80 MHz			
+	PLL_init();
+#if OS_CFG_TASK_STATS || OS_CFG_TRACE || OS_CFG_HIST || OS_CFG_IRQ_OFF_TRACK
+	// start the cycle counter used for the task accounting, the trace, the 
+	// histograms and the interrupts-disabled tracker
+	DWT_init();
+#endif
+#if OS_CFG_TASK_STATS
+	g_switch_stamp = DWT_get_cycles();
+#endif
+	
+	// enable wide timer 5 interrupt (WideTimer5A_Handler)
+	// highest priority (0), period of interruption 1 tick
+	Timer_WTimer5A_init(events_period, 0);
+	g_tick_period = events_period;
+	
+#if OS_CFG_HRTIMER
+	// enable wide timer 3 interrupt (WideTimer3A_Handler), one-shot armed 
+	// by OS_sleep_us(), highest priority (0)
+	Timer_WTimer3A_init(0);
+#endif
+	
+#if OS_CFG_PROFILE
+	// enable wide timer 4 interrupt (WideTimer4A_Handler), PC sampling
+	Profile_init();
+#endif
+
+#if OS_CFG_TICK_UNIFIED
+	// system tick interrupt (SysTick_Handler) only pended by the kernel, 
+	// lowest priority (7), the wide timer 5A ends the time slices
+	(void)time_slice;
+	SysTick_init_soft(7);
+#else
+	// enable system tick interrupt (SysTick_Handler)
+	// lowest priority (7), period of interruption 1 tick
+	SysTick_init(time_slice, true, 7);
+#endif
+	
+	// the idle task goes into the list after task 0 (alone if no task)
+	tcb_init(IDLE_TASK, idle_task, IDLE_PRIORITY, 
+		&g_idle_stack[IDLE_STACK_SIZE]);
+	IDLE_TASK->next = g_task_cnt ? g_tcbs[0].next : IDLE_TASK;
+	g_tcbs[0].next = IDLE_TASK;
+	
+	// task 0 runs first
+	gp_running_task = g_task_cnt ? &g_tcbs[0] : IDLE_TASK; 
+
+#if OS_CFG_TIMER
+	// the timer service task has its own TCB and stack, so it does not take
+	// the place of a task, and goes into the list after the first one
+	tcb_init(TIMER_TASK, timer_task, OS_CFG_TIMER_PRIORITY, 
+		&g_timer_stack[OS_CFG_TIMER_STACK_SIZE]);
+	TIMER_TASK->next = gp_running_task->next;
+	gp_running_task->next = TIMER_TASK;
+	EDF_READY(TIMER_TASK);
+#endif
+	slice_reload(gp_running_task);
+	// uninitialized events are set with a default confing
+	for (i = g_event_cnt; i < NUM_EVENTS; ++i)
+	{
+		g_ecbs[i] = ecb_default;
+	}
+	
+	// run OS kernel (this function is defined in "osasm.s" file)
+	run_os();
+}
+
+//*****************************************************************************
+//
+//! @brief Suspend the execution of the running task.
+//!
+//! This function allows the running task to release control of the CPU 
+//! voluntarily by calling a low-level system function that forces the execution 
+//! of the scheduler.
+//!
+//! @return None. 
+//
+//*****************************************************************************
+void OS_suspend(void)
+{
+	g_yield = true;
+	// give up the rest of the time slice
+	gp_running_task->slice = 0;
+	// trigger SysTick interrupt (SysTick_Handler)
+	SysTick_set_pending();
+}
+
+//*****************************************************************************
+//
+//! @brief Set the running task into sleep mode.
+//!
+//! This function sets the running task to sleep by changing the sleep filed 
+//! of the TCB to a nonzero value and suspending its execution. The time is 
+//! rounded up to the tick.
+//!
+//! @param[in] sleep_time Duration of the sleep in ms.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void OS_sleep(uint32_t sleep_time)
+{
+	TRACE(TRACE_SLEEP, TASK_ID(gp_running_task), sleep_time);
+	// store in the TCB of the running task the sleep time (no change of the
+	// tick rate in between)
+	IRQ_DISABLE();
+	gp_running_task->sleep = ms_to_ticks(sleep_time);
+	if(gp_running_task->sleep)
+	{
+		EDF_UNREADY(gp_running_task);
+	}
+	IRQ_ENABLE();
+	// release control of the CPU
+	OS_suspend();
+}
+
+//*****************************************************************************
+//
+//! @brief Sleep until an absolute time.
+//!
+//! This function sets the running task to sleep until the time 
+//! *p_last_wake + period, and advances *p_last_wake to it. Since the wake 
+//! times do not depend on when the task runs, a periodic task keeps its 
+//! exact rate in the long run, instead of drifting by its execution time 
+//! and scheduling delay as with OS_sleep(). If the time has already passed 
+//! (overrun), the task does not sleep and catches up. The wake is at the 
+//! first tick at or after the time, whatever the tick rate: the time left 
+//! is counted in microseconds from the last tick. With OS_CFG_EDF, the 
+//! deadline of the task becomes the end of the new period.
+//!
+//! The wake times are in ms (OS_time_ms), not in ticks as in the first 
+//! version of this function, so that they keep their meaning when the tick
+//! rate changes.
+//!
+//! @param[in,out] p_last_wake Time of the previous wake (ms), initialized 
+//!                with OS_time_ms() before the first call.
+//! @param[in] period Period in ms.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void OS_sleep_until(uint32_t *p_last_wake, uint32_t period)
+{
+	uint32_t wake = *p_last_wake + period, tick_us;
+	uint64_t now;
+	int64_t delta;
+#if OS_CFG_EDF
+	int64_t due;
+#endif
+
+	*p_last_wake = wake;
+	// no tick between reading the time and arming the sleep
+	IRQ_DISABLE();
+	now = g_time_us;
+	tick_us = g_tick_us;
+	// time from the last tick to the wake (us)
+	delta = (int64_t)(int32_t)(wake - (uint32_t)(now / 1000)) * 1000 - 
+		(int64_t)(now % 1000);
+	if(delta > 0)
+	{
+		TRACE(TRACE_SLEEP, TASK_ID(gp_running_task), (delta + 999) / 1000);
+		gp_running_task->sleep = (uint32_t)((delta + tick_us - 1) / tick_us);
+		EDF_UNREADY(gp_running_task);
+	}
+#if OS_CFG_EDF
+	// the job released at the wake is due at the end of its period
+	due = delta + (int64_t)period * 1000;
+	edf_release(gp_running_task, g_ticks_lo + (due > 0 ? 
+		(uint32_t)((due + tick_us - 1) / tick_us) : 0));
+#endif
+	IRQ_ENABLE();
+	if(delta > 0)
+	{
+		OS_suspend();
+	}
+}
+
+#if OS_CFG_HRTIMER
+//*****************************************************************************
+//
+//! @brief Set the running task into sleep mode, in microseconds.
+//!
+//! This function blocks the running task until OS_time_us() reaches the 
+//! current time plus sleep_time. The wake is not quantized to the tick: a 
+//! one-shot on the wide timer 3A fires at the earliest wake of all the 
+//! sleeping tasks and is re-armed from its handler, so the tick rate does 
+//! not change. The woken task preempts a task of lower priority at once.
+//!
+//! @param[in] sleep_time Duration of the sleep in us.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void OS_sleep_us(uint32_t sleep_time)
+{
+	struct tcb **pp_tcb;
+	uint64_t now;
+
+	IRQ_DISABLE();
+	now = OS_time_us();
+	gp_running_task->hr_wake = now + sleep_time;
+	gp_running_task->blocked = &g_hr_wait;
+	EDF_UNREADY(gp_running_task);
+	TRACE(TRACE_SLEEP, TASK_ID(gp_running_task), 0);
+
+	// insert in wake order (after the tasks with the same wake time)
+	pp_tcb = &gp_hr_head;
+	while(*pp_tcb && (*pp_tcb)->hr_wake <= gp_running_task->hr_wake)
+	{
+		pp_tcb = &(*pp_tcb)->hr_next;
+	}
+	gp_running_task->hr_next = *pp_tcb;
+	*pp_tcb = gp_running_task;
+
+	// the first wake changed, the timer is re-armed
+	if(gp_hr_head == gp_running_task)
+	{
+		hr_arm(now);
+	}
+	IRQ_ENABLE();
+	// release control of the CPU
+	OS_suspend();
+}
+#endif
+
+//*****************************************************************************
+//
+//! @brief Get the index of the running task.
+//!
+//! This function returns the index of the running task, in the order in 
+//! which the tasks were added. Called from an ISR, it returns the task that
+//! was interrupted.
+//!
+//! @return Index of the running task.
+//
+//*****************************************************************************
+uint8_t OS_get_task_id(void)
+{
+	return TASK_ID(gp_running_task);
+}
+
+//*****************************************************************************
+//
+//! @brief Get the system time in ticks.
+//!
+//! This function returns the number of kernel ticks since OS_start(), 
+//! whatever their length (see OS_set_tick_freq). The two words of the count
+//! are read again if the wide timer 5A handler updated them in between, so
+//! it is safe from tasks and ISRs without disabling interrupts.
+//!
+//! @return Ticks since the kernel started.
+//
+//*****************************************************************************
+uint64_t OS_time_ticks(void)
+{
+	uint32_t hi, lo;
+
+	do
+	{
+		hi = g_ticks_hi;
+		lo = g_ticks_lo;
+	} while(hi != g_ticks_hi);
+
+	return ((uint64_t)hi << 32) | lo;
+}
+
+//*****************************************************************************
+//
+//! @brief Get the system time in microseconds.
+//!
+//! This function combines the time of the last tick with the counter of the
+//! wide timer 5A, so the resolution is 1 us instead of one tick. If the 
+//! timer has reloaded but its handler has not run yet (interrupts disabled,
+//! or a caller with the same priority), the pending tick is counted here, 
+//! so the time never goes backwards. It is lock-free, like OS_time_ticks(),
+//! since the tick rate only changes in the handler too.
+//!
+//! @return Microseconds since the kernel started (0 before OS_start).
+//
+//*****************************************************************************
+uint64_t OS_time_us(void)
+{
+	uint64_t us;
+	uint32_t lo, count, period;
+
+	if(g_tick_period == 0)
+	{
+		return 0;
+	}
+
+	do
+	{
+		lo = g_ticks_lo;
+		us = g_time_us;
+		period = g_tick_period;
+		count = Timer_WTimer5A_get_count();
+		if(Timer_WTimer5A_expired())
+		{
+			// reloaded after the counter was read or before, read it 
+			// again past the reload
+			count = Timer_WTimer5A_get_count();
+			us += g_tick_us;
+		}
+	} while(lo != g_ticks_lo);
+
+	return us + (period - 1 - count) / (CPU_CLOCK_FREQ / 1000000);
+}
+
+//*****************************************************************************
+//
+//! @brief Get the system time in milliseconds.
+//!
+//! This function returns the low word of OS_time_us() in ms, which wraps 
+//! after 49 days. It is the time base of OS_sleep_until().
+//!
+//! @return Milliseconds since the kernel started.
+//
+//*****************************************************************************
+uint32_t OS_time_ms(void)
+{
+	return (uint32_t)(OS_time_us() / 1000);
+}
+
+//*****************************************************************************
+//
+//! @brief Change the tick rate.
+//!
+//! This function sets the rate of the kernel tick, e.g. to lower it while 
+//! the application is idle or raise it for shorter time slices. Everything 
+//! counted in ticks (sleeps, periodic events, software timers) is rescaled
+//! to keep its length in ms. Once the kernel runs, the change takes place 
+//! at the next tick: the timer restarts from the new period in the tick 
+//! handler. The time from the tick to the restart is added to the system 
+//! time in whole microseconds, so OS_time_us() falls behind by less than 
+//! 1 us (plus the few cycles of the restart) per change. The tick length 
+//! must be a whole number of microseconds and of core clock cycles.
+//!
+//! @param[in] freq Tick rate (Hz), e.g. 100, 1000 or 10000.
+//!
+//! @return 0 if successful, -1 if the rate is not valid.
+//
+//*****************************************************************************
+int32_t OS_set_tick_freq(uint32_t freq)
+{
+	if((freq == 0) || (freq > 1000000) || (1000000 % freq) || 
+		(CPU_CLOCK_FREQ % freq))
+	{
+		return -1;
+	}
+
+	if(g_tick_period == 0)
+	{
+		// before OS_start, nothing runs yet
+		tick_rate_apply(freq);
+	}
+	else
+	{
+		g_tick_freq_next = freq;
+	}
+	return 0;
+}
+
+//*****************************************************************************
+//
+//! @brief Get the tick rate.
+//!
+//! @return Tick rate (Hz), OS_CFG_TICK_FREQ unless changed.
+//
+//*****************************************************************************
+uint32_t OS_get_tick_freq(void)
+{
+	return g_tick_freq;
+}
+
+//*****************************************************************************
+//
+//! @brief Initialize a TCB, not blocked and not sleeping.
+//!
+//! @param[in] p_tcb Pointer to the TCB.
+//! @param[in] p_task Pointer to the task function.
+//! @param[in] priority Priority level of the task.
+//! @param[in] p_stack_top Pointer past the last word of the stack.
+//!
+//! @return None.
+//
+//*****************************************************************************
+static void tcb_init(struct tcb *p_tcb, void (*p_task)(void), 
+	uint8_t priority, uint32_t *p_stack_top)
+{
+	// not blocked, not sleep
+	p_tcb->blocked = 0;
+	p_tcb->sleep = 0;
+	p_tcb->priority = priority;
+	p_tcb->threshold = priority;
+	p_tcb->quantum = 0;
+	p_tcb->slice = 0;
+#if OS_CFG_BUDGET
+	p_tcb->budget = 0;
+	p_tcb->base_priority = priority;
+	p_tcb->base_threshold = priority;
+#endif
+#if OS_CFG_EDF
+	// no deadline until the first release
+	p_tcb->has_deadline = 0;
+	p_tcb->heap_idx = EDF_NONE;
+#endif
+#if OS_CFG_TASK_STATS
+	p_tcb->cycles = 0;
+	p_tcb->preemptions = 0;
+	p_tcb->yields = 0;
+#endif
+#if OS_CFG_HIST
+	p_tcb->wake_stamp = 0;
+#endif
+#if OS_CFG_RTC
+	p_tcb->p_job = 0;
+	p_tcb->rtc_state = RTC_IDLE;
+#endif
+
+	// initilze task stack, the program counter (PC) points to the task 
+	// function
+	p_tcb->sp = CPU_init_stack(p_stack_top, p_task);
+}
+
+//*****************************************************************************
+//
+//! @brief Add task into the TCB array.
+//!
+//! This function initializes and adds a new task into the TCB array, with
+//! its stack at p_stack_top. No dynamic memory allocation used.
+//!
+//! @param[in] p_task Pointer to the task function.
+//! @param[in] priority Priority level of the task.
+//! @param[in] p_stack_top Pointer past the last word of the stack.
+//!
+//! @return Index of the task if successful, -1 if TCBs full.
+//
+//*****************************************************************************
+static int32_t add_task(void (*p_task)(void), uint8_t priority, 
+	uint32_t *p_stack_top)
+{
+	if(g_task_cnt == NUM_TASKS)
+	{
+		return -1; // no additional space
+	}
+
+	// point to the next element (form a circular linked list)
+	g_tcbs[g_task_cnt].next = (g_task_cnt == 0) ? &g_tcbs[0] : g_tcbs[0].next;
+	g_tcbs[0].next = &g_tcbs[g_task_cnt];
+
+	tcb_init(&g_tcbs[g_task_cnt], p_task, priority, p_stack_top);
+#if OS_CFG_EDF
+	edf_insert(&g_tcbs[g_task_cnt]);
+#endif
+	
+	g_task_cnt++;
+
+	return g_task_cnt - 1;
+}
+
+//*****************************************************************************
+//
+//! @brief Add task into the TCB array.
+//!
+//! This function initializes and adds a new task into the TCB array. No 
+//! dynamic memory allocation used. The task gets a time slice of one tick.
+//!
+//! @param[in] p_task Pointer to the task function.
+//! @param[in] priority Priority level of the task.
+//!
+//! @return Index of the task (see OS_get_task_id) if successful, -1 if 
+//!         TCBs or stacks full.
+//
+//*****************************************************************************
+int32_t OS_add_task(void (*p_task)(void), uint8_t priority)
+{
+#if NUM_STACKS > 0
+	int32_t task_id;
+
+	if(g_stack_cnt == NUM_STACKS)
+	{
+		return -1; // no additional space
+	}
+
+	task_id = add_task(p_task, priority, &g_stacks[g_stack_cnt][STACK_SIZE]);
+	if(task_id >= 0)
+	{
+		g_stack_cnt++;
+	}
+
+	return task_id;
+#else
+	// every task brings its stack (OS_add_task_stack)
+	(void)p_task;
+	(void)priority;
+	return -1;
+#endif
+}
+
+//*****************************************************************************
+//
+//! @brief Add task into the TCB array, with a stack of the caller.
+//!
+//! This function is OS_add_task() for a task that needs a stack of another
+//! size than STACK_SIZE, or whose stack is declared with the task (e.g. 
+//! os::StaticTask of "os.hpp"). It takes no row of g_stacks.
+//!
+//! @param[in] p_task Pointer to the task function.
+//! @param[in] priority Priority level of the task.
+//! @param[in] p_stack Pointer to the stack, 8-byte aligned.
+//! @param[in] size Number of 32-bit words of the stack, even and at least
+//!                 OS_STACK_MIN_SIZE.
+//!
+//! @return Index of the task (see OS_get_task_id) if successful, -1 if 
+//!         TCBs full or the stack is too small.
+//
+//*****************************************************************************
+int32_t OS_add_task_stack(void (*p_task)(void), uint8_t priority, 
+	uint32_t *p_stack, uint32_t size)
+{
+	if((size < OS_STACK_MIN_SIZE) || (size & 1))
+	{
+		return -1;
+	}
+
+	return add_task(p_task, priority, &p_stack[size]);
+}
+
+#if OS_CFG_RTC
+//*****************************************************************************
+//
+//! @brief Add a run-to-completion task into the TCB array.
+//!
+//! This function adds a task that calls p_job once each time p_sema is 
+//! signalled, instead of a task that loops pending on it. The task has no
+//! stack of its own: it is started on the shared stack when activated, and
+//! gives it back once its job returns with no signal left. The job may be
+//! preempted, but a blocking call keeps the shared stack and delays the 
+//! run-to-completion tasks of the same or a lower priority until it returns.
+//!
+//! @param[in] p_job Pointer to the job function, which returns when done.
+//! @param[in] priority Priority level of the task.
+//! @param[in] p_sema Pointer to an initialized semaphore that activates it.
+//!
+//! @return Index of the task (see OS_get_task_id) if successful, -1 if 
+//!         TCBs full or if it would be the first task (which runs first at
+//!         OS_start and must have a stack of its own).
+//
+//*****************************************************************************
+int32_t OS_add_rtc_task(void (*p_job)(void), uint8_t priority, 
+	int32_t *p_sema)
+{
+	int32_t task_id;
+
+	if(g_task_cnt == 0)
 	{
-		g_ecbs[i] = ecb_default;
+		return -1;
 	}
-	
-	// run OS kernel (this function is defined in "osasm.s" file)
-	run_os();
+
+	task_id = add_task(rtc_task, priority, 
+		&g_rtc_stack[OS_CFG_RTC_STACK_SIZE]);
+	if(task_id < 0)
+	{
+		return -1;
+	}
+	g_tcbs[task_id].p_job = p_job;
+	g_tcbs[task_id].p_job_sema = p_sema;
+	g_tcbs[task_id].rtc_prev = 0;
+	// the first activation is taken as in OS_Semaphore_pend, from then on 
+	// by rtc_task
+	(*p_sema) = (*p_sema) - 1;
+	if((*p_sema) < 0)
+	{
+		g_tcbs[task_id].blocked = p_sema;
+	}
+
+	return task_id;
 }
+#endif
 
 //*****************************************************************************
 //
-//! @brief Suspend the execution of the running task.
+//! @brief Set the time slice of a task.
 //!
-//! This function allows the running task to release control of the CPU 
-//! voluntarily by calling a low-level system function that forces the execution 
-//! of the scheduler.
+//! This function sets how long a task keeps the CPU before the next ready 
+//! task of the same priority gets it, rounded up to the tick. Tasks of 
+//! higher priority still preempt it at once, and a task that blocks, sleeps
+//! or yields gives up the rest of its slice. It takes effect from the next
+//! time slice of the task.
 //!
-//! @return None. 
+//! @param[in] task_id Index of the task, as returned by OS_add_task().
+//! @param[in] quantum Time slice in ms, 0 for one tick (the default).
+//!
+//! @return 0 if successful, -1 if there is no such task.
 //
 //*****************************************************************************
-void OS_suspend(void)
+int32_t OS_set_task_quantum(uint8_t task_id, uint32_t quantum)
 {
-	// trigger SysTick interrupt (SysTick_Handler)
-	SysTick_set_pending();
+	if(task_id >= g_task_cnt)
+	{
+		return -1;
+	}
+
+	g_tcbs[task_id].quantum = quantum;
+
+	return 0;
 }
 
 //*****************************************************************************
 //
-//! @brief Set the running task into sleep mode.
+//! @brief Set the preemption threshold of a task.
 //!
-//! This function sets the running task to sleep by changing the sleep filed 
-//! of the TCB to a nonzero value and suspending its execution.
+//! This function lets a task run, once it has the CPU, as if it had the 
+//! priority of its threshold: only the tasks of a higher priority than the
+//! threshold preempt it, and the tasks of the same priority wait for it to
+//! block, sleep or yield instead of taking turns. Tasks that share a 
+//! threshold never preempt each other, which saves context switches, and 
+//! never hold their stacks at the same time. It only applies to the fixed
+//! priority scheduling.
 //!
-//! @param[in] sleep_time Duration of the sleep in ms.
+//! @param[in] task_id Index of the task, as returned by OS_add_task().
+//! @param[in] threshold From 0 (never preempted by another task) to the 
+//!                      priority of the task (no threshold, the default).
 //!
-//! @return None.
+//! @return 0 if successful, -1 if there is no such task or the threshold is
+//!         below its priority.
 //
 //*****************************************************************************
-void OS_sleep(uint32_t sleep_time)
+int32_t OS_set_task_threshold(uint8_t task_id, uint8_t threshold)
 {
-	// store in the TCB of the running task the sleep time
-	gp_running_task->sleep = sleep_time;
-	// release control of the CPU
-	OS_suspend();
+	struct tcb *p_tcb;
+
+	if(task_id >= g_task_cnt)
+	{
+		return -1;
+	}
+	p_tcb = &g_tcbs[task_id];
+
+	IRQ_DISABLE();
+#if OS_CFG_BUDGET
+	if(threshold > p_tcb->base_priority)
+	{
+		IRQ_ENABLE();
+		return -1;
+	}
+	p_tcb->base_threshold = threshold;
+	// a demoted task gets it back at the replenishment
+	if(p_tcb->priority == p_tcb->base_priority)
+	{
+		p_tcb->threshold = threshold;
+	}
+#else
+	if(threshold > p_tcb->priority)
+	{
+		IRQ_ENABLE();
+		return -1;
+	}
+	p_tcb->threshold = threshold;
+#endif
+	IRQ_ENABLE();
+
+	return 0;
 }
 
+#if OS_CFG_BUDGET
 //*****************************************************************************
 //
-//! @brief Add task into the TCB array.
+//! @brief Set the CPU budget of a task.
 //!
-//! This function initializes and adds a new task into the TCB array. No 
-//! dynamic memory allocation used. 
+//! This function limits a task to budget ms of CPU time in every period, 
+//! counted in ticks, so that bursty aperiodic work cannot delay the tasks 
+//! of lower priority by more than that. The budget is restored in full at 
+//! the start of each period (deferrable server). A task that used it up is
+//! suspended until then (OS_BUDGET_SUSPEND), or runs at the lowest priority
+//! (OS_BUDGET_DEMOTE, suspended with OS_CFG_EDF). The first period starts 
+//! now.
 //!
-//! @param[in] p_task Pointer to the task function.
-//! @param[in] priority Priority level of the task.
+//! @param[in] task_id Index of the task, as returned by OS_add_task().
+//! @param[in] budget CPU time per period in ms, 0 to remove the limit.
+//! @param[in] period Replenishment period in ms.
+//! @param[in] action OS_BUDGET_SUSPEND or OS_BUDGET_DEMOTE.
 //!
-//! @return 0 if successful, -1 if TCBs full.
+//! @return 0 if successful, -1 if there is no such task or the budget is 
+//!         longer than the period.
 //
 //*****************************************************************************
-int32_t OS_add_task(void (*p_task)(void), uint8_t priority)
+int32_t OS_set_task_budget(uint8_t task_id, uint32_t budget, uint32_t period,
+	uint8_t action)
 {
-	static uint8_t task_cnt = 0;
+	struct tcb *p_tcb;
 
-	if(task_cnt == NUM_TASKS)
+	if((task_id >= g_task_cnt) || (budget && ((budget > period) || 
+		(period > UINT32_MAX / 1000))))
 	{
-		return -1; // no additional space
+		return -1;
 	}
 
-	// point to the next element (form a circular linked list)
-	g_tcbs[task_cnt].next = &g_tcbs[task_cnt == 0 ? 0 : (task_cnt - 1)];
-	g_tcbs[0].next = &g_tcbs[task_cnt];
-	
-	// not blocked, not sleep
-	g_tcbs[task_cnt].blocked = 0;
-	g_tcbs[task_cnt].sleep = 0;
-	g_tcbs[task_cnt].priority = priority;
-
-	// initilze task stack
-	init_task_stack(task_cnt);
-	// program counter (PC) points to the task function
-	g_stacks[task_cnt][STACK_SIZE-2] = (uint32_t)(p_task);
-	
-	task_cnt++;
+	p_tcb = &g_tcbs[task_id];
+	IRQ_DISABLE();
+	// end the current limit, if any
+	p_tcb->priority = p_tcb->base_priority;
+	p_tcb->threshold = p_tcb->base_threshold;
+	if(p_tcb->blocked == &g_budget_wait)
+	{
+		p_tcb->blocked = 0;
+		EDF_READY(p_tcb);
+	}
+	p_tcb->budget = budget * 1000;
+	p_tcb->budget_period = period * 1000;
+	p_tcb->budget_used = 0;
+	p_tcb->budget_next = period * 1000;
+	p_tcb->budget_demote = (action == OS_BUDGET_DEMOTE);
+	IRQ_ENABLE();
 
 	return 0;
 }
+#endif
 
 //*****************************************************************************
 //
@@ -394,7 +2282,7 @@ int32_t OS_add_task(void (*p_task)(void), uint8_t priority)
 //! dynamic memory allocation used.
 //!
 //! @param[in] p_sema Pointer to an initialized semaphore.
-//! @param[in] period Event execution period.
+//! @param[in] period Event execution period in ms (rounded up to the tick).
 //!
 //! @return 0 if successful, -1 if ECBs full.
 //
@@ -408,13 +2296,69 @@ int32_t OS_add_periodic_event(int32_t *p_sema, uint32_t period)
 
 	// add periodic event (only semaphores are supported)
 	g_ecbs[g_event_cnt].semaphore = p_sema;
-	g_ecbs[g_event_cnt].period = period;
+	g_ecbs[g_event_cnt].period_ms = period;
+	g_ecbs[g_event_cnt].period = ms_to_ticks(period);
 
 	g_event_cnt++;
 
 	return 0;
 }
 
+#if OS_CFG_RTA
+//*****************************************************************************
+//
+//! @brief Add a periodic event into the ECB array, if schedulable.
+//!
+//! This function adds a periodic event as OS_add_periodic_event() does, but 
+//! only if the task that handles it still meets its deadline (the next 
+//! release), and so do the others. The set made of the events added with 
+//! this function is checked with a response-time analysis (rta.c), or the
+//! utilization test with OS_CFG_EDF. The events added without a WCET are 
+//! not part of it, so their load must be accounted for in the WCETs.
+//!
+//! @param[in] p_sema Pointer to an initialized semaphore.
+//! @param[in] period Event execution period in ms (rounded up to the tick).
+//! @param[in] wcet Worst-case execution time of the handler task per event
+//!                 (us).
+//! @param[in] priority Priority of the handler task (not used with EDF).
+//!
+//! @return 0 if successful, -1 if ECBs full, -2 if the set would not be 
+//!         schedulable.
+//
+//*****************************************************************************
+int32_t OS_add_periodic_event_wcet(int32_t *p_sema, uint32_t period, 
+	uint32_t wcet, uint8_t priority)
+{
+	struct rta_task *p_task = &g_rta_set[g_rta_cnt];
+
+	if(g_event_cnt == NUM_EVENTS)
+	{
+		return -1; // no additional space
+	}
+	if((period == 0) || (period > UINT32_MAX / 1000))
+	{
+		return -2;
+	}
+
+	// analyse the set with the new event at its end
+	p_task->period = period * 1000;
+	p_task->wcet = wcet;
+	p_task->deadline = 0;
+	p_task->priority = priority;
+#if OS_CFG_EDF
+	if(!Rta_edf_check(g_rta_set, g_rta_cnt + 1))
+#else
+	if(!Rta_fp_check(g_rta_set, g_rta_cnt + 1))
+#endif
+	{
+		return -2; // rejected
+	}
+	g_rta_cnt++;
+
+	return OS_add_periodic_event(p_sema, period);
+}
+#endif
+
 //*****************************************************************************
 //
 //! @brief Initialize semaphore.
@@ -446,7 +2390,7 @@ void OS_Semaphore_init(int32_t *p_sema, int32_t value)
 void OS_Semaphore_pend(int32_t *p_sema)
 {
 	// disable interrupts
-	CPU_disable_irq();
+	IRQ_DISABLE();
 	(*p_sema) = (*p_sema) - 1;
 
 	// check if semaphore is occupied
@@ -454,12 +2398,49 @@ void OS_Semaphore_pend(int32_t *p_sema)
 	{
 		// store reason of blocking
 		gp_running_task->blocked = p_sema;
-		CPU_enable_irq();
+		EDF_UNREADY(gp_running_task);
+		TRACE(TRACE_BLOCK, TASK_ID(gp_running_task), p_sema);
+		IRQ_ENABLE();
 		// run scheduler
 		OS_suspend();            
 	}
+	else
+	{
+		TRACE(TRACE_PEND, TASK_ID(gp_running_task), p_sema);
+	}
 	// enable interrupts
-	CPU_enable_irq();
+	IRQ_ENABLE();
+}
+
+//*****************************************************************************
+//
+//! @brief Wait on a semaphore without blocking.
+//!
+//! This function decrements a semaphore only if it is available, so it can
+//! be polled by a task that must not block (e.g. the coroutine scheduler of
+//! "os_coro.hpp").
+//!
+//! @param[in] p_sema Pointer to an initialized semaphore.
+//!
+//! @return 0 if taken, -1 if not available.
+//
+//*****************************************************************************
+int32_t OS_Semaphore_try_pend(int32_t *p_sema)
+{
+	int32_t status = -1;
+
+	// disable interrupts
+	IRQ_DISABLE();
+	if((*p_sema) > 0)
+	{
+		(*p_sema) = (*p_sema) - 1;
+		TRACE(TRACE_PEND, TASK_ID(gp_running_task), p_sema);
+		status = 0;
+	}
+	// enable interrupts
+	IRQ_ENABLE();
+
+	return status;
 }
 
 //*****************************************************************************
@@ -467,6 +2448,8 @@ void OS_Semaphore_pend(int32_t *p_sema)
 //! @brief Signal a semaphore.
 //!
 //! This function increments a semaphore and unblocks task if appropriate.
+//! With OS_CFG_POST_PREEMPT, an unblocked task of higher priority than the 
+//! running one runs right away (at the end of the ISR, if called from one).
 //!
 //! @param[in] p_sema Pointer to an initialized semaphore.
 //!
@@ -475,26 +2458,11 @@ void OS_Semaphore_pend(int32_t *p_sema)
 //*****************************************************************************
 void OS_Semaphore_post(int32_t *p_sema)
 {
-	struct tcb *tmp;
-
 	// disable interrupts
-	CPU_disable_irq();
-	(*p_sema) = (*p_sema) + 1;
-	
-	// if there is a task blocked on this semaphore,
-	// then find it and unblock it
-	if((*p_sema) <= 0)
-	{
-		tmp = gp_running_task->next;
-		while(tmp->blocked != p_sema)
-		{
-			tmp = tmp->next;
-		}
-		// unblock task
-		tmp->blocked = 0; 
-	}
+	IRQ_DISABLE();
+	semaphore_post(p_sema);
 	// enable interrupts
-	CPU_enable_irq();
+	IRQ_ENABLE();
 }
 
 //*****************************************************************************
@@ -566,6 +2534,224 @@ uint32_t OS_Fifo_get(void)
 	return data;
 }
 
+//*****************************************************************************
+//
+//! @brief Get an entry from the fifo without blocking.
+//!
+//!	@param[out] p_data Data retrieved, if any.
+//!
+//!	@return 0 if successful, -1 if the fifo is empty.
+//
+//*****************************************************************************
+int8_t OS_Fifo_try_get(uint32_t *p_data)
+{
+	if(OS_Semaphore_try_pend(&g_fifo_curr_size) < 0)
+	{
+		return -1; // fifo is empty
+	}
+	// get data and update index
+	*p_data = g_fifo[g_get_idx];
+	g_get_idx = g_get_idx < (FIFO_SIZE - 1) ? (g_get_idx + 1) : 0;
+
+	return 0;
+}
+
+#if OS_CFG_TIMER
+//*****************************************************************************
+//
+//! @brief Initialize a software timer.
+//!
+//! This function sets the callback of a timer, which is left stopped. The 
+//! callbacks of all timers run in the timer service task, one at a time, 
+//! so they must not block.
+//!
+//! @param[in] p_timer Pointer to the timer.
+//! @param[in] p_callback Function to call when the timer expires.
+//! @param[in] p_arg Argument of the callback.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void OS_Timer_init(struct os_timer *p_timer, void (*p_callback)(void *p_arg),
+	void *p_arg)
+{
+	p_timer->p_callback = p_callback;
+	p_timer->p_arg = p_arg;
+	p_timer->delay = 0;
+	p_timer->period = 0;
+	p_timer->active = 0;
+}
+
+//*****************************************************************************
+//
+//! @brief Start a software timer.
+//!
+//! This function arms a timer to expire delay ms from now and then, if 
+//! period is nonzero, every period ms (auto-reload), rounded up to the 
+//! tick. A running timer is restarted. It is O(1) and can be called from 
+//! tasks and ISRs.
+//!
+//! @param[in] p_timer Pointer to an initialized timer.
+//! @param[in] delay Time (ms) to the first expiry (0 is taken as 1).
+//! @param[in] period Time (ms) between expiries, 0 for a one-shot.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void OS_Timer_start(struct os_timer *p_timer, uint32_t delay, uint32_t period)
+{
+	IRQ_DISABLE();
+	if(p_timer->active)
+	{
+		timer_remove(p_timer);
+	}
+	p_timer->delay = delay ? delay : 1;
+	p_timer->period = period;
+	p_timer->expiry = g_ticks_lo + ms_to_ticks(p_timer->delay);
+	timer_insert(p_timer);
+	IRQ_ENABLE();
+}
+
+//*****************************************************************************
+//
+//! @brief Stop a software timer.
+//!
+//! This function disarms a timer, if running. It is O(1). A callback that 
+//! has already been taken out by the service task still runs.
+//!
+//! @param[in] p_timer Pointer to an initialized timer.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void OS_Timer_stop(struct os_timer *p_timer)
+{
+	IRQ_DISABLE();
+	if(p_timer->active)
+	{
+		timer_remove(p_timer);
+	}
+	IRQ_ENABLE();
+}
+
+//*****************************************************************************
+//
+//! @brief Reset a software timer.
+//!
+//! This function restarts a timer with the delay and period of its last 
+//! start, e.g. to push back a protocol timeout. It is O(1).
+//!
+//! @param[in] p_timer Pointer to a timer started at least once.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void OS_Timer_reset(struct os_timer *p_timer)
+{
+	OS_Timer_start(p_timer, p_timer->delay, p_timer->period);
+}
+#endif
+
+#if OS_CFG_TASK_STATS
+//*****************************************************************************
+//
+//! @brief Take a snapshot of the task statistics.
+//!
+//! This function copies the runtime accounting of every added task, in the 
+//! order in which they were added. The cycles of the running task include 
+//! the current time slice up to the moment of the call. 
+//!
+//! @param[out] p_stats Array to hold the statistics.
+//! @param[in] size Number of elements of the array.
+//!
+//! @return Number of tasks copied into the array.
+//
+//*****************************************************************************
+uint8_t OS_get_task_stats(struct os_task_stats *p_stats, uint8_t size)
+{
+	uint8_t i;
+	uint32_t now;
+
+	if(size > g_task_cnt)
+	{
+		size = g_task_cnt;
+	}
+
+	// disable interrupts (consistent snapshot)
+	IRQ_DISABLE();
+	now = DWT_get_cycles();
+	for (i = 0; i < size; i++)
+	{
+		p_stats[i].cycles = g_tcbs[i].cycles;
+		p_stats[i].preemptions = g_tcbs[i].preemptions;
+		p_stats[i].yields = g_tcbs[i].yields;
+		p_stats[i].priority = g_tcbs[i].priority;
+		if(&g_tcbs[i] == gp_running_task)
+		{
+			p_stats[i].cycles += (uint32_t)(now - g_switch_stamp);
+		}
+	}
+	// enable interrupts
+	IRQ_ENABLE();
+
+	return size;
+}
+#endif
+
+#if OS_CFG_IRQ_OFF_TRACK
+//*****************************************************************************
+//
+//! @brief Get the longest time with interrupts disabled by the kernel.
+//!
+//! This function copies the longest critical section measured since the 
+//! start (or the last reset) and the kernel function where it began.
+//!
+//! @param[out] p_irq_off Pointer to the structure that receives the result.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void OS_get_irq_off(struct os_irq_off *p_irq_off)
+{
+	struct os_irq_off snapshot;
+
+	// disable interrupts (consistent snapshot, not measured itself)
+	CPU_disable_irq();
+	snapshot = g_irq_off;
+	// enable interrupts
+	CPU_enable_irq();
+
+	*p_irq_off = snapshot;
+}
+
+//*****************************************************************************
+//
+//! @brief Restart the interrupts-disabled tracker.
+//!
+//! This function clears the longest critical section, so that the worst 
+//! case of a given phase of the application can be measured.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void OS_reset_irq_off(void)
+{
+	const struct os_irq_off irq_off_default = 
+	{
+		.max_cycles = 0, 
+		.p_func = 0, 
+		.line = 0, 
+		.count = 0
+	};
+
+	// disable interrupts
+	CPU_disable_irq();
+	g_irq_off = irq_off_default;
+	// enable interrupts
+	CPU_enable_irq();
+}
+#endif
+
 //*****************************************************************************
 //
 //  Interrupt Request (IRQ) Handlers.
@@ -575,15 +2761,70 @@ uint32_t OS_Fifo_get(void)
 //
 //! @brief IRQ Handler for the wide timer 5A.
 //!
-//!	This handler runs every millisecond to update any pending events.
+//!	This handler runs every tick to update any pending events.
 //!
 //!	@return None.
 //
 //*****************************************************************************
 void WideTimer5A_Handler(void)
 {
+#if OS_CFG_HIST
+	uint32_t start = DWT_get_cycles();
+#endif
+	TRACE(TRACE_ISR_ENTER, TASK_ID(gp_running_task), TRACE_ISR_EVENTS);
 	// clear the interrupt flag
 	Timer_WTimer5A_clear_irq();
 	// runs events
 	real_time_events();
+	TRACE(TRACE_ISR_EXIT, TASK_ID(gp_running_task), TRACE_ISR_EVENTS);
+#if OS_CFG_HIST
+	Hist_record(&g_hist_isr, DWT_get_cycles() - start);
+#endif
+}
+
+//*****************************************************************************
+//
+//! @brief IRQ Handler for the wide timer 3A.
+//!
+//!	This handler runs when the first high-resolution sleep ends. It wakes 
+//!	every task whose time has come, arms the one-shot for the next one and 
+//!	calls the scheduler if a woken task has a higher priority than the 
+//!	running one. Without OS_CFG_HRTIMER the timer is never enabled.
+//!
+//!	@return None.
+//
+//*****************************************************************************
+void WideTimer3A_Handler(void)
+{
+#if OS_CFG_HRTIMER
+	uint64_t now;
+	struct tcb *p_tcb;
+	bool call_scheduler = false;
+
+	TRACE(TRACE_ISR_ENTER, TASK_ID(gp_running_task), TRACE_ISR_HRTIMER);
+	// clear the interrupt flag
+	Timer_WTimer3A_clear_irq();
+
+	now = OS_time_us();
+	while(gp_hr_head && gp_hr_head->hr_wake <= now)
+	{
+		p_tcb = gp_hr_head;
+		gp_hr_head = p_tcb->hr_next;
+		p_tcb->blocked = 0;
+		TRACE(TRACE_WAKE, TASK_ID(p_tcb), 0);
+		WAKE_STAMP(p_tcb);
+		EDF_READY(p_tcb);
+		if(PREEMPTS(p_tcb, gp_running_task))
+		{
+			call_scheduler = true;
+		}
+	}
+	hr_arm(now);
+
+	if(call_scheduler)
+	{
+		SysTick_set_pending();
+	}
+	TRACE(TRACE_ISR_EXIT, TASK_ID(gp_running_task), TRACE_ISR_HRTIMER);
+#endif
 }
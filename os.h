@@ -10,6 +10,63 @@
 
 #ifndef __OS_H__
 #define __OS_H__
+
+#include "os_config.h"
+#if OS_CFG_HIST
+#include "hist.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//*****************************************************************************
+//
+//	Data structures for the API
+//
+//*****************************************************************************
+
+#if OS_CFG_TASK_STATS
+struct os_task_stats
+{
+	uint64_t cycles;		// CPU cycles consumed by the task
+	uint32_t preemptions;	// times switched out while still ready to run
+	uint32_t yields;		// times the CPU was released voluntarily
+	uint8_t priority;		// priority level of the task
+};
+#endif
+
+#define OS_STACK_MIN_SIZE 	32			// words of a task stack, the saved
+										// context (16) and a few calls
+
+#if OS_CFG_BUDGET
+#define OS_BUDGET_SUSPEND 	0			// block until the replenishment
+#define OS_BUDGET_DEMOTE 	1			// run at the lowest priority until then
+#endif
+
+#if OS_CFG_TIMER
+struct os_timer
+{
+	struct os_timer *p_next;	// list of the wheel slot
+	struct os_timer *p_prev;
+	uint32_t expiry;			// tick of the next expiry
+	uint32_t delay;				// ms to the first expiry
+	uint32_t period;			// ms between expiries (0 for a one-shot)
+	void (*p_callback)(void *p_arg);
+	void *p_arg;
+	uint8_t active;			// 1 if started and not expired or stopped
+};
+#endif
+
+#if OS_CFG_IRQ_OFF_TRACK
+struct os_irq_off
+{
+	uint32_t max_cycles;	// longest time with interrupts disabled
+	const char *p_func;		// kernel function where it began (NULL if none)
+	uint16_t line;			// line of that critical section in "os.c"
+	uint32_t count;			// number of critical sections measured
+};
+#endif
 	
 //*****************************************************************************
 //
@@ -20,17 +77,83 @@
 extern void OS_start(void);
 extern void OS_suspend(void);
 extern void OS_sleep(uint32_t sleep_time);
+extern void OS_sleep_until(uint32_t *p_last_wake, uint32_t period);
+#if OS_CFG_HRTIMER
+extern void OS_sleep_us(uint32_t sleep_time);
+#endif
+extern uint8_t OS_get_task_id(void);
+extern uint64_t OS_time_ticks(void);
+extern uint64_t OS_time_us(void);
+extern uint32_t OS_time_ms(void);
+extern int32_t OS_set_tick_freq(uint32_t freq);
+extern uint32_t OS_get_tick_freq(void);
 
 extern int32_t OS_add_task(void (*p_task)(void), uint8_t priority);
+extern int32_t OS_add_task_stack(void (*p_task)(void), uint8_t priority, 
+	uint32_t *p_stack, uint32_t size);
+#if OS_CFG_RTC
+extern int32_t OS_add_rtc_task(void (*p_job)(void), uint8_t priority, 
+	int32_t *p_sema);
+#endif
+extern int32_t OS_set_task_quantum(uint8_t task_id, uint32_t quantum);
+extern int32_t OS_set_task_threshold(uint8_t task_id, uint8_t threshold);
+#if OS_CFG_BUDGET
+extern int32_t OS_set_task_budget(uint8_t task_id, uint32_t budget, 
+	uint32_t period, uint8_t action);
+#endif
 extern int32_t OS_add_periodic_event(int32_t *p_sema, uint32_t period);
+#if OS_CFG_RTA
+extern int32_t OS_add_periodic_event_wcet(int32_t *p_sema, uint32_t period,
+	uint32_t wcet, uint8_t priority);
+#endif
 
 
 extern void OS_Semaphore_init(int32_t *p_sema, int32_t value);
 extern void OS_Semaphore_pend(int32_t *p_sema);
+extern int32_t OS_Semaphore_try_pend(int32_t *p_sema);
 extern void OS_Semaphore_post(int32_t *p_sema);
 
 extern void OS_Fifo_init(void);
 extern int8_t OS_Fifo_put(uint32_t data);
 extern uint32_t OS_Fifo_get(void);
+extern int8_t OS_Fifo_try_get(uint32_t *p_data);
+
+#if OS_CFG_TIMER
+extern void OS_Timer_init(struct os_timer *p_timer, 
+	void (*p_callback)(void *p_arg), void *p_arg);
+extern void OS_Timer_start(struct os_timer *p_timer, uint32_t delay, 
+	uint32_t period);
+extern void OS_Timer_stop(struct os_timer *p_timer);
+extern void OS_Timer_reset(struct os_timer *p_timer);
+#endif
+
+#if OS_CFG_TASK_STATS
+extern uint8_t OS_get_task_stats(struct os_task_stats *p_stats, uint8_t size);
+#endif
+
+#if OS_CFG_IRQ_OFF_TRACK
+extern void OS_get_irq_off(struct os_irq_off *p_irq_off);
+extern void OS_reset_irq_off(void);
+#endif
+
+//*****************************************************************************
+//
+//	The following are the kernel histograms (core clock cycles)
+//
+//*****************************************************************************
+
+#if OS_CFG_HIST
+extern struct hist g_hist_sched;		// run time of the scheduler
+extern struct hist g_hist_wake;			// from ready (post, end of sleep) 
+										// to chosen by the scheduler
+extern struct hist g_hist_isr;			// run time of WideTimer5A_Handler
+#if OS_CFG_IRQ_OFF_TRACK
+extern struct hist g_hist_irq_off;		// kernel critical sections
+#endif
+#endif
+
+#ifdef __cplusplus
+}
+#endif
 
 #endif	// __OS_H__
@@ -0,0 +1,229 @@
+//*****************************************************************************
+//
+//  C++ interface of the OS kernel.
+//  File: 		os.hpp
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//  Header-only layer over "os.h". The kernel objects are typed and sized at
+//  compile time, and every member function is an inline call of the C API,
+//  so the layer adds no code or data of its own:
+//
+//    static os::Queue<uint16_t, 8> g_samples;
+//    static os::Mutex g_uart;
+//    static os::StaticTask<64> g_consumer;
+//
+//    void consumer(void)
+//    {
+//        uint16_t sample = g_samples.get();
+//        os::LockGuard<os::Mutex> lock(g_uart);
+//        ...
+//    }
+//
+//    g_consumer.add(&consumer, 2);
+//
+//  The objects must not be copied or moved, since the kernel keeps their
+//  address while a task is blocked on them. Static objects are constant
+//  initialized (constexpr constructors), so they need no code at startup.
+//
+//  Requires C++17.
+//
+//*****************************************************************************
+
+#ifndef __OS_HPP__
+#define __OS_HPP__
+
+#include <stdint.h>
+#include <type_traits>
+
+#include "os.h"
+
+namespace os {
+
+//*****************************************************************************
+//
+//  This class defines a counting semaphore (OS_Semaphore_xxx).
+//
+//*****************************************************************************
+
+class Semaphore
+{
+public:
+	constexpr explicit Semaphore(int32_t value = 0) noexcept : m_value(value) {}
+	Semaphore(const Semaphore &) = delete;
+	Semaphore &operator=(const Semaphore &) = delete;
+
+	//! Wait for the semaphore, blocking if not available.
+	void pend(void) noexcept { OS_Semaphore_pend(&m_value); }
+	//! Take the semaphore if available, without blocking.
+	bool try_pend(void) noexcept { return OS_Semaphore_try_pend(&m_value) == 0; }
+	//! Signal the semaphore.
+	void post(void) noexcept { OS_Semaphore_post(&m_value); }
+	//! Count (negative if tasks are blocked on it).
+	int32_t count(void) const noexcept { return m_value; }
+	//! Semaphore for the C API (e.g. OS_add_periodic_event).
+	constexpr int32_t *native(void) noexcept { return &m_value; }
+
+private:
+	int32_t m_value;
+};
+
+static_assert(sizeof(Semaphore) == sizeof(int32_t),
+	"os::Semaphore must be laid out as the C semaphore");
+
+//*****************************************************************************
+//
+//  This class defines a mutual exclusion lock, a binary semaphore. There is
+//  no priority inheritance, and unlock is not checked against the owner.
+//
+//*****************************************************************************
+
+class Mutex
+{
+public:
+	constexpr Mutex(void) noexcept : m_sema(1) {}
+	Mutex(const Mutex &) = delete;
+	Mutex &operator=(const Mutex &) = delete;
+
+	void lock(void) noexcept { m_sema.pend(); }
+	bool try_lock(void) noexcept { return m_sema.try_pend(); }
+	void unlock(void) noexcept { m_sema.post(); }
+
+private:
+	Semaphore m_sema;
+};
+
+//*****************************************************************************
+//
+//  This class defines a lock held for the scope of the guard.
+//
+//*****************************************************************************
+
+template<typename M>
+class LockGuard
+{
+public:
+	explicit LockGuard(M &mutex) noexcept : m_mutex(mutex) { m_mutex.lock(); }
+	~LockGuard() { m_mutex.unlock(); }
+	LockGuard(const LockGuard &) = delete;
+	LockGuard &operator=(const LockGuard &) = delete;
+
+private:
+	M &m_mutex;
+};
+
+//*****************************************************************************
+//
+//  This class defines a fifo of N entries of type T, with the storage in
+//  the object. As the kernel fifo (OS_Fifo_xxx), it takes one producer and
+//  one consumer: put never blocks, get blocks while the fifo is empty. The
+//  free slots are counted apart from the entries, and a slot is only given
+//  back once its entry was read, so a full fifo is never overwritten.
+//
+//*****************************************************************************
+
+template<typename T, uint32_t N>
+class Queue
+{
+	static_assert(N > 0, "os::Queue needs at least one entry");
+	static_assert(N <= (uint32_t)INT32_MAX, "os::Queue is too large");
+	static_assert(std::is_trivially_copyable<T>::value,
+		"os::Queue entries are copied, also from interrupts");
+
+public:
+	constexpr Queue(void) noexcept : m_entries{}, m_free((int32_t)N),
+		m_size(0), m_put_idx(0), m_get_idx(0) {}
+	Queue(const Queue &) = delete;
+	Queue &operator=(const Queue &) = delete;
+
+	//! Put an entry, false if the fifo is full.
+	bool put(const T &entry) noexcept
+	{
+		if(!m_free.try_pend())
+		{
+			return false;
+		}
+		m_entries[m_put_idx] = entry;
+		m_put_idx = (m_put_idx < (N - 1)) ? (m_put_idx + 1) : 0;
+		m_size.post();
+		return true;
+	}
+
+	//! Get an entry, blocking while the fifo is empty.
+	T get(void) noexcept
+	{
+		m_size.pend();
+		return take();
+	}
+
+	//! Get an entry if there is one, without blocking.
+	bool try_get(T &entry) noexcept
+	{
+		if(!m_size.try_pend())
+		{
+			return false;
+		}
+		entry = take();
+		return true;
+	}
+
+	static constexpr uint32_t capacity(void) noexcept { return N; }
+
+private:
+	T take(void) noexcept
+	{
+		T entry = m_entries[m_get_idx];
+
+		m_get_idx = (m_get_idx < (N - 1)) ? (m_get_idx + 1) : 0;
+		m_free.post();		// the slot can be written again
+		return entry;
+	}
+
+	T m_entries[N];
+	Semaphore m_free;		// slots that put may write
+	Semaphore m_size;		// entries in the fifo
+	uint32_t m_put_idx;
+	uint32_t m_get_idx;
+};
+
+//*****************************************************************************
+//
+//  This class defines a task with a stack of StackWords 32-bit words in the
+//  object (OS_add_task_stack), instead of a row of g_stacks.
+//
+//*****************************************************************************
+
+template<uint32_t StackWords>
+class StaticTask
+{
+	static_assert(StackWords >= OS_STACK_MIN_SIZE,
+		"os::StaticTask stack below OS_STACK_MIN_SIZE");
+	static_assert(StackWords % 2 == 0,
+		"os::StaticTask stack must keep the 8-byte alignment");
+
+public:
+	constexpr StaticTask(void) noexcept : m_stack{}, m_id(-1) {}
+	StaticTask(const StaticTask &) = delete;
+	StaticTask &operator=(const StaticTask &) = delete;
+
+	//! Add the task (see OS_add_task), its index or -1 if the TCBs are full.
+	int32_t add(void (*p_task)(void), uint8_t priority) noexcept
+	{
+		m_id = OS_add_task_stack(p_task, priority, m_stack, StackWords);
+		return m_id;
+	}
+
+	//! Index of the task, -1 if not added.
+	int32_t id(void) const noexcept { return m_id; }
+
+	static constexpr uint32_t stack_words(void) noexcept { return StackWords; }
+
+private:
+	alignas(8) uint32_t m_stack[StackWords];
+	int32_t m_id;
+};
+
+}	// namespace os
+
+#endif	// __OS_HPP__
@@ -0,0 +1,190 @@
+//*****************************************************************************
+//
+//  Compile-time configuration of the OS kernel.
+//  File: 		os_config.h
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//*****************************************************************************
+
+#ifndef __OS_CONFIG_H__
+#define __OS_CONFIG_H__
+
+//*****************************************************************************
+//
+//  The following is the define for the core clock frequency (Hz).
+//
+//*****************************************************************************
+
+#ifndef CPU_CLOCK_FREQ
+#define CPU_CLOCK_FREQ		80000000
+#endif
+
+//*****************************************************************************
+//
+//  The following are defines for the size of the kernel arrays. A system
+//  declared as a table (os_system.hpp) is checked against them.
+//
+//*****************************************************************************
+
+#ifndef OS_CFG_NUM_TASKS
+#define OS_CFG_NUM_TASKS 	8			// TCBs (1 to 255)
+#endif
+
+#ifndef OS_CFG_NUM_EVENTS
+#define OS_CFG_NUM_EVENTS 	2			// periodic events (1 to 255)
+#endif
+
+#ifndef OS_CFG_STACK_SIZE
+#define OS_CFG_STACK_SIZE 	100			// 32-bit words per row of g_stacks
+#endif
+
+#ifndef OS_CFG_FIFO_SIZE
+#define OS_CFG_FIFO_SIZE 	10			// entries of the kernel fifo
+#endif
+
+//*****************************************************************************
+//
+//  The following are defines for the optional features of the kernel. Each
+//  one can be overridden from the compiler command line (e.g. -DOS_CFG_X=0).
+//
+//*****************************************************************************
+
+#ifndef OS_CFG_TICK_FREQ
+#define OS_CFG_TICK_FREQ 	1000		// initial kernel tick (Hz), a divisor
+										// of 1000000 (see OS_set_tick_freq)
+#endif
+
+#ifndef OS_CFG_TICK_UNIFIED
+#define OS_CFG_TICK_UNIFIED 0			// 1 to run the tick from the wide 
+										// timer 5A only, and the scheduler 
+										// (SysTick) only when needed
+#endif
+
+#ifndef OS_CFG_EDF
+#define OS_CFG_EDF 			0			// 1 to schedule by earliest deadline 
+										// instead of by fixed priority
+#endif
+
+#ifndef OS_CFG_RTA
+#define OS_CFG_RTA 			0			// 1 to check the schedulability of the
+										// periodic events added with a WCET
+#endif
+
+#ifndef OS_CFG_BUDGET
+#define OS_CFG_BUDGET 		0			// 1 for the CPU budgets per task 
+										// (OS_set_task_budget)
+#endif
+
+#ifndef OS_CFG_RTC
+#define OS_CFG_RTC 			0			// 1 for the run-to-completion tasks 
+										// on a shared stack (OS_add_rtc_task,
+										// fixed priority only)
+#endif
+
+#ifndef OS_CFG_RTC_TASKS
+#define OS_CFG_RTC_TASKS 	2			// TCBs without a stack of their own
+#endif
+
+#ifndef OS_CFG_RTC_STACK_SIZE
+#define OS_CFG_RTC_STACK_SIZE 100		// 32-bit words of the shared stack
+#endif
+
+#ifndef OS_CFG_NUM_STACKS
+#define OS_CFG_NUM_STACKS 	(OS_CFG_NUM_TASKS - OS_CFG_RTC * OS_CFG_RTC_TASKS)
+										// rows of g_stacks for OS_add_task 
+										// (0 if every task brings its stack)
+#endif
+
+#ifndef OS_CFG_TASK_STATS
+#define OS_CFG_TASK_STATS 	1			// 1 to account the CPU cycles, 
+										// preemptions and yields per task
+#endif
+
+#ifndef OS_CFG_POST_PREEMPT
+#define OS_CFG_POST_PREEMPT 0			// 1 to run the scheduler as soon as a
+										// post unblocks a task of higher 
+										// priority than the running one
+#endif
+
+#ifndef OS_CFG_TRACE
+#define OS_CFG_TRACE 		0			// 1 to record the kernel events into 
+										// the trace buffer (trace.c)
+#endif
+
+#ifndef OS_CFG_TRACE_SIZE
+#define OS_CFG_TRACE_SIZE 	256			// number of trace records (power of 
+										// two, 8 bytes each)
+#endif
+
+#ifndef OS_CFG_PROFILE
+#define OS_CFG_PROFILE 		0			// 1 to sample the PC of the running 
+										// task (profile.c, Wide Timer4A)
+#endif
+
+#ifndef OS_CFG_PROFILE_FREQ
+#define OS_CFG_PROFILE_FREQ 997			// samples per second (not a divisor 
+										// of the tick, to avoid aliasing)
+#endif
+
+#ifndef OS_CFG_PROFILE_SIZE
+#define OS_CFG_PROFILE_SIZE 256			// number of distinct PCs (power of 
+										// two, 12 bytes each)
+#endif
+
+#ifndef OS_CFG_HRTIMER
+#define OS_CFG_HRTIMER 		0			// 1 for the microsecond sleeps 
+										// (OS_sleep_us, Wide Timer3A)
+#endif
+
+#ifndef OS_CFG_TIMER
+#define OS_CFG_TIMER 		0			// 1 for the software timers (one 
+										// service task runs the callbacks)
+#endif
+
+#ifndef OS_CFG_TIMER_WHEEL
+#define OS_CFG_TIMER_WHEEL 	32			// slots of the timer wheel (power of
+										// two, one pointer each)
+#endif
+
+#ifndef OS_CFG_TIMER_PRIORITY
+#define OS_CFG_TIMER_PRIORITY 0			// priority of the timer service task
+#endif
+
+#ifndef OS_CFG_TIMER_STACK_SIZE
+#define OS_CFG_TIMER_STACK_SIZE OS_CFG_STACK_SIZE	// 32-bit words of the stack
+										// of the service task (callbacks)
+#endif
+
+#ifndef OS_CFG_IRQ_OFF_TRACK
+#define OS_CFG_IRQ_OFF_TRACK 0			// 1 to time the kernel critical 
+										// sections and keep the longest one
+#endif
+
+#ifndef OS_CFG_HIST
+#define OS_CFG_HIST 		0			// 1 to record the scheduler time, the 
+										// wake latency and the ISR time into
+										// histograms (hist.c)
+#endif
+
+#ifndef OS_CFG_HIST_SUB_BITS
+#define OS_CFG_HIST_SUB_BITS 4			// histogram buckets per power of two
+										// (log2), 4 is a 6.25% error
+#endif
+
+//*****************************************************************************
+//
+//  The following is the define for placing the kernel data into the named
+//  sections of the GNU Arm linker script (tm4c123gh6pm.ld). The other 
+//  toolchains and the host port keep the default placement.
+//
+//*****************************************************************************
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__ARMCC_VERSION)
+#define OS_SECTION(name)	__attribute__((section(name)))
+#else
+#define OS_SECTION(name)
+#endif
+
+#endif	// __OS_CONFIG_H__
@@ -0,0 +1,461 @@
+//*****************************************************************************
+//
+//  C++20 coroutine tasks on top of the OS kernel.
+//  File: 		os_coro.hpp
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//  A coroutine (os::coro::Task) is a flow of sequential code that waits with
+//  co_await instead of blocking. All the coroutines run in one kernel task
+//  (os::coro::run), so a flow costs its frame, a block of a static arena,
+//  instead of a row of g_stacks:
+//
+//    os::coro::Task consumer(void)
+//    {
+//        while(1)
+//        {
+//            uint32_t data = co_await os::coro::fifo_get();
+//            co_await os::coro::sleep(10);
+//        }
+//    }
+//
+//    os::coro::spawn(consumer());
+//    OS_add_task(&os::coro::run, 3);
+//
+//  The scheduler task resumes every coroutine whose wait is over, polling
+//  the waits with the non-blocking calls of the kernel (OS_time_ms,
+//  OS_Semaphore_try_pend, OS_Fifo_try_get). When none is ready it sleeps
+//  for OS_CORO_IDLE_MS, which bounds the wake latency of a coroutine. The
+//  coroutines run at the priority of the scheduler task and must only wait
+//  with co_await: a blocking call blocks all of them.
+//
+//  Requires C++20 (GCC 11 or later), without exceptions. The functions are
+//  not reentrant, spawn coroutines before OS_start or from a coroutine.
+//
+//*****************************************************************************
+
+#ifndef __OS_CORO_HPP__
+#define __OS_CORO_HPP__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <coroutine>
+
+#include "os.h"
+
+//*****************************************************************************
+//
+//  The following are defines for the coroutine arena. Each can be
+//  overridden from the compiler command line.
+//
+//*****************************************************************************
+
+#ifndef OS_CORO_FRAMES
+#define OS_CORO_FRAMES 		64			// coroutine frames in the arena
+#endif
+
+#ifndef OS_CORO_FRAME_SIZE
+#define OS_CORO_FRAME_SIZE 	96			// bytes per frame (multiple of 8)
+#endif
+
+#ifndef OS_CORO_IDLE_MS
+#define OS_CORO_IDLE_MS 	1			// sleep of the scheduler task when no
+										// coroutine is ready
+#endif
+
+static_assert(OS_CORO_FRAME_SIZE % 8 == 0,
+	"OS_CORO_FRAME_SIZE must be a multiple of 8");
+
+namespace os {
+namespace coro {
+
+//*****************************************************************************
+//
+//  The following is the arena of the coroutine frames: fixed-size blocks,
+//  handed out in order and then from a list of the freed ones.
+//
+//*****************************************************************************
+
+namespace detail {
+
+struct Block
+{
+	Block *p_next;				// next free block
+};
+
+alignas(8) inline unsigned char g_arena[OS_CORO_FRAMES][OS_CORO_FRAME_SIZE];
+inline Block *gp_free;			// freed blocks (nullptr if none)
+inline uint16_t g_arena_used;	// blocks handed out at least once
+inline uint16_t g_frames;		// frames in use
+inline size_t g_frame_max;		// largest frame asked for (bytes)
+
+//*****************************************************************************
+//
+//! @brief Allocate a coroutine frame.
+//!
+//! @param[in] size Size of the frame (bytes).
+//!
+//! @return Pointer to the frame, nullptr if too large or the arena is full.
+//
+//*****************************************************************************
+inline void *frame_alloc(size_t size) noexcept
+{
+	void *p_frame = nullptr;
+
+	if(size > g_frame_max)
+	{
+		g_frame_max = size;
+	}
+	if(size > OS_CORO_FRAME_SIZE)
+	{
+		return nullptr;
+	}
+	if(gp_free != nullptr)
+	{
+		p_frame = gp_free;
+		gp_free = gp_free->p_next;
+	}
+	else if(g_arena_used < OS_CORO_FRAMES)
+	{
+		p_frame = g_arena[g_arena_used++];
+	}
+	if(p_frame != nullptr)
+	{
+		g_frames++;
+	}
+	return p_frame;
+}
+
+//*****************************************************************************
+//
+//! @brief Free a coroutine frame.
+//
+//*****************************************************************************
+inline void frame_free(void *p_frame) noexcept
+{
+	Block *p_block = static_cast<Block *>(p_frame);
+
+	p_block->p_next = gp_free;
+	gp_free = p_block;
+	g_frames--;
+}
+
+}	// namespace detail
+
+//*****************************************************************************
+//
+//  This class defines a coroutine task. The coroutine starts suspended, and
+//  runs once given to spawn(). The frame goes back to the arena when the
+//  coroutine returns, or when a Task that was not spawned is destroyed.
+//
+//*****************************************************************************
+
+class Task
+{
+public:
+	struct promise_type
+	{
+		promise_type *p_next = nullptr;				// list of the scheduler
+		bool (*p_poll)(void *p_awaiter) = nullptr;	// wait (nullptr if ready)
+		void *p_awaiter = nullptr;					// argument of p_poll
+
+		Task get_return_object(void) noexcept
+		{
+			return Task(handle::from_promise(*this));
+		}
+		static Task get_return_object_on_allocation_failure(void) noexcept
+		{
+			return Task(handle());
+		}
+		std::suspend_always initial_suspend(void) noexcept { return {}; }
+		std::suspend_always final_suspend(void) noexcept { return {}; }
+		void return_void(void) noexcept {}
+		void unhandled_exception(void) noexcept {}
+
+		static void *operator new(size_t size) noexcept
+		{
+			return detail::frame_alloc(size);
+		}
+		static void operator delete(void *p_frame) noexcept
+		{
+			detail::frame_free(p_frame);
+		}
+
+		// suspend until p_poll(p_awaiter) returns true
+		void wait(bool (*p_poll_fn)(void *), void *p_awaiter_arg) noexcept
+		{
+			p_poll = p_poll_fn;
+			p_awaiter = p_awaiter_arg;
+		}
+	};
+	using handle = std::coroutine_handle<promise_type>;
+
+	Task(Task &&other) noexcept : m_handle(other.m_handle)
+	{
+		other.m_handle = handle();
+	}
+	Task(const Task &) = delete;
+	Task &operator=(const Task &) = delete;
+	Task &operator=(Task &&) = delete;
+	~Task()
+	{
+		if(m_handle)
+		{
+			m_handle.destroy();
+		}
+	}
+
+	//! True if the frame was allocated.
+	explicit operator bool(void) const noexcept { return bool(m_handle); }
+
+	//! Hand the coroutine over (to the scheduler).
+	handle release(void) noexcept
+	{
+		handle h = m_handle;
+
+		m_handle = handle();
+		return h;
+	}
+
+private:
+	explicit Task(handle h) noexcept : m_handle(h) {}
+
+	handle m_handle;
+};
+
+//*****************************************************************************
+//
+//  The following are the lists of the scheduler. The coroutines spawned are
+//  kept apart until the next pass of run(), so that a coroutine can spawn
+//  another one while the list is walked.
+//
+//*****************************************************************************
+
+namespace detail {
+
+inline Task::promise_type *gp_tasks;	// coroutines in the scheduler
+inline Task::promise_type *gp_spawned;	// coroutines not yet in gp_tasks
+
+}	// namespace detail
+
+//*****************************************************************************
+//
+//! @brief Add a coroutine to the scheduler.
+//!
+//! @param[in] task Coroutine, it first runs in the next pass of run().
+//!
+//! @return True if successful, false if its frame could not be allocated.
+//
+//*****************************************************************************
+inline bool spawn(Task &&task) noexcept
+{
+	Task::promise_type *p_promise;
+
+	if(!task)
+	{
+		return false;
+	}
+	p_promise = &task.release().promise();
+	p_promise->p_next = detail::gp_spawned;
+	detail::gp_spawned = p_promise;
+	return true;
+}
+
+//*****************************************************************************
+//
+//! @brief Scheduler task of the coroutines.
+//!
+//! This function is the body of the kernel task that runs the coroutines
+//! (see OS_add_task). Each pass resumes, in turn, the coroutines whose wait
+//! is over, and frees the ones that returned. A pass that resumes none
+//! sleeps for OS_CORO_IDLE_MS.
+//!
+//! @return None.
+//
+//*****************************************************************************
+inline void run(void)
+{
+	Task::promise_type **pp_promise, *p_promise;
+	Task::handle h;
+	bool resumed;
+
+	while(1)
+	{
+		// take the coroutines spawned since the last pass
+		while(detail::gp_spawned != nullptr)
+		{
+			p_promise = detail::gp_spawned;
+			detail::gp_spawned = p_promise->p_next;
+			p_promise->p_next = detail::gp_tasks;
+			detail::gp_tasks = p_promise;
+		}
+
+		resumed = false;
+		pp_promise = &detail::gp_tasks;
+		while(*pp_promise != nullptr)
+		{
+			p_promise = *pp_promise;
+			if((p_promise->p_poll == nullptr) ||
+				p_promise->p_poll(p_promise->p_awaiter))
+			{
+				p_promise->p_poll = nullptr;
+				h = Task::handle::from_promise(*p_promise);
+				h.resume();
+				resumed = true;
+				if(h.done())
+				{
+					*pp_promise = p_promise->p_next;
+					h.destroy();
+					continue;
+				}
+			}
+			pp_promise = &p_promise->p_next;
+		}
+
+		if(!resumed)
+		{
+			OS_sleep(OS_CORO_IDLE_MS);
+		}
+	}
+}
+
+//*****************************************************************************
+//
+//! @brief Get the number of coroutine frames in use.
+//
+//*****************************************************************************
+inline uint16_t frames_used(void) noexcept
+{
+	return detail::g_frames;
+}
+
+//*****************************************************************************
+//
+//! @brief Get the largest coroutine frame asked for, to size the arena.
+//
+//*****************************************************************************
+inline size_t frame_size_max(void) noexcept
+{
+	return detail::g_frame_max;
+}
+
+//*****************************************************************************
+//
+//  The following are the awaitables. The coroutine is suspended, and the
+//  scheduler polls the wait until it is over. The state of the wait lives
+//  in the coroutine frame.
+//
+//*****************************************************************************
+
+//! Wait for a number of ms (see sleep).
+class Sleep
+{
+public:
+	explicit Sleep(uint32_t ms) noexcept : m_ms(ms), m_wake(0) {}
+
+	bool await_ready(void) const noexcept { return m_ms == 0; }
+	void await_suspend(Task::handle h) noexcept
+	{
+		m_wake = OS_time_ms() + m_ms;
+		h.promise().wait(&poll, this);
+	}
+	void await_resume(void) const noexcept {}
+
+private:
+	static bool poll(void *p_awaiter) noexcept
+	{
+		Sleep *p_sleep = static_cast<Sleep *>(p_awaiter);
+
+		return (int32_t)(OS_time_ms() - p_sleep->m_wake) >= 0;
+	}
+
+	uint32_t m_ms;
+	uint32_t m_wake;			// OS_time_ms() to resume at
+};
+
+//! Wait on a semaphore (see pend).
+class Pend
+{
+public:
+	explicit Pend(int32_t *p_sema) noexcept : mp_sema(p_sema) {}
+
+	bool await_ready(void) const noexcept
+	{
+		return OS_Semaphore_try_pend(mp_sema) == 0;
+	}
+	void await_suspend(Task::handle h) noexcept
+	{
+		h.promise().wait(&poll, this);
+	}
+	void await_resume(void) const noexcept {}
+
+private:
+	static bool poll(void *p_awaiter) noexcept
+	{
+		return OS_Semaphore_try_pend(static_cast<Pend *>(p_awaiter)->mp_sema)
+			== 0;
+	}
+
+	int32_t *mp_sema;
+};
+
+//! Wait for an entry of the fifo (see fifo_get).
+class FifoGet
+{
+public:
+	FifoGet(void) noexcept : m_data(0) {}
+
+	bool await_ready(void) noexcept { return OS_Fifo_try_get(&m_data) == 0; }
+	void await_suspend(Task::handle h) noexcept
+	{
+		h.promise().wait(&poll, this);
+	}
+	uint32_t await_resume(void) const noexcept { return m_data; }
+
+private:
+	static bool poll(void *p_awaiter) noexcept
+	{
+		return OS_Fifo_try_get(&static_cast<FifoGet *>(p_awaiter)->m_data)
+			== 0;
+	}
+
+	uint32_t m_data;
+};
+
+//*****************************************************************************
+//
+//! @brief Suspend the coroutine for a number of ms, as OS_sleep().
+//
+//*****************************************************************************
+inline Sleep sleep(uint32_t ms) noexcept
+{
+	return Sleep(ms);
+}
+
+//*****************************************************************************
+//
+//! @brief Suspend the coroutine until it takes a semaphore, as
+//!        OS_Semaphore_pend().
+//
+//*****************************************************************************
+inline Pend pend(int32_t *p_sema) noexcept
+{
+	return Pend(p_sema);
+}
+
+//*****************************************************************************
+//
+//! @brief Suspend the coroutine until it gets an entry of the fifo, as
+//!        OS_Fifo_get(). The co_await gives the entry.
+//
+//*****************************************************************************
+inline FifoGet fifo_get(void) noexcept
+{
+	return FifoGet();
+}
+
+}	// namespace coro
+}	// namespace os
+
+#endif	// __OS_CORO_HPP__
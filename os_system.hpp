@@ -0,0 +1,263 @@
+//*****************************************************************************
+//
+//  Static system configuration of the OS kernel.
+//  File: 		os_system.hpp
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//  The tasks and periodic events of an application declared as constexpr
+//  tables, checked at compile time and added in one call:
+//
+//    static os::Semaphore sema_A;
+//
+//    static constexpr std::array g_tasks{
+//        os::TaskCfg{&task_A, 0, 48},
+//        os::TaskCfg{&task_B, 1, 64},
+//    };
+//    static constexpr std::array g_events{
+//        os::EventCfg{sema_A, 10},
+//    };
+//    static os::System<g_tasks, g_events> g_system;
+//
+//    g_system.start();
+//
+//  The tables must fit the kernel arrays (OS_CFG_NUM_TASKS and
+//  OS_CFG_NUM_EVENTS), the priorities must be unique, and every stack must
+//  be at least OS_STACK_MIN_SIZE words, an even count. The stacks of all
+//  the tasks are one array in the System object, of the exact total, and
+//  the total must not exceed the stack budget (MaxStackWords). A table
+//  that breaks a rule does not compile.
+//
+//  System::exact is true when the kernel arrays are sized to the tables:
+//  OS_CFG_NUM_TASKS and OS_CFG_NUM_EVENTS equal to them, and no rows of
+//  g_stacks (OS_CFG_NUM_STACKS=0). With OS_SYSTEM_EXACT=1 it is required.
+//  The tasks of the kernel are not in the tables nor in these arrays: the
+//  idle task and, with OS_CFG_TIMER, the timer service task have a TCB and
+//  a stack of their own (the timer one of OS_CFG_TIMER_STACK_SIZE words).
+//
+//  Requires C++17.
+//
+//*****************************************************************************
+
+#ifndef __OS_SYSTEM_HPP__
+#define __OS_SYSTEM_HPP__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <array>
+
+#include "os.hpp"
+
+//*****************************************************************************
+//
+//  The following are defines for the checks. Each can be overridden from the
+//  compiler command line.
+//
+//*****************************************************************************
+
+#ifndef OS_SYSTEM_STACK_WORDS
+#define OS_SYSTEM_STACK_WORDS 	(24 * 1024 / 4)	// stack budget (32-bit words)
+#endif
+
+#ifndef OS_SYSTEM_EXACT
+#define OS_SYSTEM_EXACT 		0			// 1 to require the kernel arrays
+											// sized to the tables
+#endif
+
+namespace os {
+
+//*****************************************************************************
+//
+//  The following are the entries of the tables.
+//
+//*****************************************************************************
+
+//! Task with a stack of stack_words 32-bit words (see OS_add_task_stack).
+struct TaskCfg
+{
+	void (*p_task)(void);
+	uint8_t priority;
+	uint32_t stack_words;
+};
+
+//! Periodic event, posting a semaphore every period_ms ms (see
+//! OS_add_periodic_event).
+struct EventCfg
+{
+	constexpr EventCfg(Semaphore &sema, uint32_t period) noexcept :
+		p_sema(sema.native()), period_ms(period) {}
+
+	int32_t *p_sema;
+	uint32_t period_ms;
+};
+
+//! Table of a system without periodic events.
+inline constexpr std::array<EventCfg, 0> no_events{};
+
+//*****************************************************************************
+//
+//  The following are the checks of the tables, run at compile time.
+//
+//*****************************************************************************
+
+namespace detail {
+
+template<size_t N>
+constexpr bool priorities_unique(const std::array<TaskCfg, N> &tasks)
+{
+	for (size_t i = 0; i < N; i++)
+	{
+		for (size_t j = i + 1; j < N; j++)
+		{
+			if(tasks[i].priority == tasks[j].priority)
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+template<size_t N>
+constexpr bool stacks_valid(const std::array<TaskCfg, N> &tasks)
+{
+	for (size_t i = 0; i < N; i++)
+	{
+		if((tasks[i].stack_words < OS_STACK_MIN_SIZE) ||
+			(tasks[i].stack_words % 2 != 0))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+template<size_t N>
+constexpr bool tasks_valid(const std::array<TaskCfg, N> &tasks)
+{
+	for (size_t i = 0; i < N; i++)
+	{
+		if(tasks[i].p_task == nullptr)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+template<size_t N>
+constexpr bool events_valid(const std::array<EventCfg, N> &events)
+{
+	for (size_t i = 0; i < N; i++)
+	{
+		if((events[i].p_sema == nullptr) || (events[i].period_ms == 0))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// stack words of the tasks before task idx (idx = N for the total)
+template<size_t N>
+constexpr uint64_t stack_offset(const std::array<TaskCfg, N> &tasks,
+	size_t idx)
+{
+	uint64_t words = 0;
+
+	for (size_t i = 0; i < idx; i++)
+	{
+		words += tasks[i].stack_words;
+	}
+	return words;
+}
+
+}	// namespace detail
+
+//*****************************************************************************
+//
+//  This class defines the system of the tables Tasks (std::array of TaskCfg)
+//  and Events (std::array of EventCfg), with the stacks of the tasks in the
+//  object.
+//
+//*****************************************************************************
+
+template<const auto &Tasks, const auto &Events = no_events,
+	uint32_t MaxStackWords = OS_SYSTEM_STACK_WORDS>
+class System
+{
+public:
+	static constexpr size_t num_tasks = Tasks.size();
+	static constexpr size_t num_events = Events.size();
+	static constexpr uint64_t stack_words = detail::stack_offset(Tasks,
+		num_tasks);
+	static constexpr bool exact = (num_tasks == OS_CFG_NUM_TASKS) &&
+		(num_events == OS_CFG_NUM_EVENTS) && (OS_CFG_NUM_STACKS == 0);
+
+	static_assert(num_tasks > 0, "os::System needs at least one task");
+	static_assert(num_tasks <= OS_CFG_NUM_TASKS,
+		"os::System has more tasks than OS_CFG_NUM_TASKS");
+	static_assert(num_events <= OS_CFG_NUM_EVENTS,
+		"os::System has more events than OS_CFG_NUM_EVENTS");
+	static_assert(detail::tasks_valid(Tasks), "os::System task without code");
+	static_assert(detail::priorities_unique(Tasks),
+		"os::System task priorities must be unique");
+	static_assert(detail::stacks_valid(Tasks),
+		"os::System stack below OS_STACK_MIN_SIZE or odd");
+	static_assert(stack_words <= MaxStackWords,
+		"os::System stacks exceed the stack budget");
+	static_assert(detail::events_valid(Events),
+		"os::System event without semaphore or period");
+	static_assert(!OS_CFG_TIMER ||
+		(OS_CFG_TIMER_STACK_SIZE >= OS_STACK_MIN_SIZE),
+		"OS_CFG_TIMER_STACK_SIZE below OS_STACK_MIN_SIZE");
+	static_assert(!OS_SYSTEM_EXACT || exact,
+		"kernel arrays not sized to os::System (OS_CFG_NUM_TASKS, "
+		"OS_CFG_NUM_EVENTS, OS_CFG_NUM_STACKS=0)");
+
+	constexpr System(void) noexcept : m_stacks{} {}
+	System(const System &) = delete;
+	System &operator=(const System &) = delete;
+
+	//*************************************************************************
+	//
+	//! @brief Add the tasks and events of the tables, then start the OS.
+	//!
+	//! The tasks are added in table order, so the index of a task (see
+	//! OS_get_task_id) is its row if no task was added before.
+	//!
+	//! @return Only if a task or event could not be added (TCBs or ECBs
+	//!         taken by calls outside the tables).
+	//
+	//*************************************************************************
+	void start(void) noexcept
+	{
+		for (size_t i = 0; i < num_tasks; i++)
+		{
+			if(OS_add_task_stack(Tasks[i].p_task, Tasks[i].priority,
+				&m_stacks[detail::stack_offset(Tasks, i)],
+				Tasks[i].stack_words) < 0)
+			{
+				return;
+			}
+		}
+		for (size_t i = 0; i < num_events; i++)
+		{
+			if(OS_add_periodic_event(Events[i].p_sema, Events[i].period_ms)
+				< 0)
+			{
+				return;
+			}
+		}
+
+		OS_start();
+	}
+
+private:
+	alignas(8) uint32_t m_stacks[stack_words];
+};
+
+}	// namespace os
+
+#endif	// __OS_SYSTEM_HPP__
@@ -11,7 +11,9 @@
         EXTERN  gp_running_task
         EXPORT  run_os
         EXPORT  SysTick_Handler
+        EXPORT  WideTimer4A_Handler
         IMPORT  scheduler
+        IMPORT  Profile_sample [WEAK]   ; only linked with OS_CFG_PROFILE
 
 SysTick_Handler               		; 1) Saves R0-R3,R12,LR,PC,PSR
     CPSID   I                	 	; 2) Prevent interrupt during switch
@@ -40,6 +42,15 @@ run_os
     ADD     SP,SP,#4           		; discard PSR
     CPSIE   I                  		; Enable interrupts at processor level
     BX      LR                 		; start first thread
+
+WideTimer4A_Handler                 ; profiler tick (see "profile.h")
+    TST     LR, #4                  ; 1) which stack holds the frame
+    ITE     EQ
+    MRSEQ   R0, MSP
+    MRSNE   R0, PSP
+    LDR     R0, [R0, #24]           ; 2) R0 = stacked PC
+    B       Profile_sample          ; 3) Profile_sample(pc) returns for us
+    BX      LR                      ;    not reached with the profiler built
 	
 
     ALIGN
@@ -0,0 +1,43 @@
+//*****************************************************************************
+//  console.c - Text console over semihosting
+//  Runs on LM3S6965 under QEMU
+//  Ronald Rodriguez Ruiz
+//  October 18, 2026
+//*****************************************************************************
+
+#include <stdint.h>
+#include "console.h"
+#include "cpu.h"
+#include "semihost.h"
+
+//*****************************************************************************
+//
+//! @brief Write a string to the console of the host (QEMU stdout).
+//!
+//! The semihosting call stops the emulated CPU, so interrupts are disabled to
+//! keep the call atomic with respect to the kernel.
+//!
+//! @param[in] p_str Null-terminated string.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Console_write(const char *p_str)
+{
+    CPU_disable_irq();
+    Semihost_call(SEMIHOST_SYS_WRITE0, p_str);
+    CPU_enable_irq();
+}
+
+//*****************************************************************************
+//
+//! @brief End the simulation with the given status.
+//
+//*****************************************************************************
+void Console_exit(int32_t status)
+{
+    CPU_disable_irq();
+    Semihost_call(SEMIHOST_SYS_EXIT, (const void *)(status == 0 ?
+        SEMIHOST_EXIT_SUCCESS : SEMIHOST_EXIT_FAILURE));
+    while(1);
+}
@@ -0,0 +1,75 @@
+//*****************************************************************************
+//  dwt.c - Cycle counter over the SysTick
+//  Runs on LM3S6965 under QEMU
+//  Ronald Rodriguez Ruiz
+//  October 18, 2026
+//
+//  QEMU does not model the DWT cycle counter (it reads as zero), and the
+//  GPTM counters of the Stellaris model cannot be read back either. The
+//  SysTick counter is emulated, so the cycle count is the sum of the
+//  distances it has counted down between two reads. A count above the one
+//  of the last read means that it went through zero and started again from
+//  RELOAD, so the counter must be read at least once per SysTick period: one
+//  tick, or 2^24 cycles (335 ms) with the unified tick. The tick handler
+//  reads it on every tick (timer.c).
+//
+//  The kernel never writes the counter on this port (PORT_SYSTICK_CYCLES,
+//  systick.c): a yield does not restart the tick, and a new tick period
+//  starts when the period in progress ends.
+//*****************************************************************************
+
+#include <stdint.h>
+#include "dwt.h"
+#include "tm4c123gh6pm.h"
+
+static uint32_t g_cycles;               // cycles at the last read
+static uint32_t g_last;                 // SysTick count at the last read
+
+//*****************************************************************************
+//
+//! @brief Initialize the cycle counter.
+//!
+//! The SysTick is started by the kernel (SysTick_init or SysTick_init_soft),
+//! so there is nothing to set up.
+//
+//*****************************************************************************
+void DWT_init(void)
+{
+    g_cycles = 0;
+    g_last = NVIC_ST_CURRENT_R;
+}
+
+//*****************************************************************************
+//
+//! @brief Read the cycle counter.
+//!
+//! It runs with interrupts disabled, since it updates the count of the last
+//! read.
+//!
+//! @return Number of core clock cycles counted by the SysTick.
+//
+//*****************************************************************************
+uint32_t DWT_get_cycles(void)
+{
+    uint32_t primask, current, cycles;
+
+    __asm volatile("mrs %0, primask\n"
+                   "cpsid i" : "=r"(primask) : : "memory");
+    current = NVIC_ST_CURRENT_R;
+    if(current > g_last)
+    {
+        //
+        //  Down to zero, one cycle to reload, then down from RELOAD
+        //
+        g_cycles += g_last + 1 + NVIC_ST_RELOAD_R - current;
+    }
+    else
+    {
+        g_cycles += g_last - current;
+    }
+    g_last = current;
+    cycles = g_cycles;
+    __asm volatile("msr primask, %0" : : "r"(primask) : "memory");
+
+    return cycles;
+}
@@ -0,0 +1,61 @@
+//*****************************************************************************
+//  pll.c - Software functions for the Phase-Locked Loop (PLL)
+//  Runs on LM3S6965 (QEMU lm3s6965evb)
+//  Ronald Rodriguez Ruiz
+//  October 18, 2026
+//
+//  The LM3S6965 has the same system control block as the TM4C123, so the
+//  TM4C123 register definitions are used. It only has the legacy RCC
+//  register, and its PLL runs at 200 MHz (50 MHz core clock at most).
+//*****************************************************************************
+
+#include "tm4c123gh6pm.h"
+#include "pll.h"
+
+//*****************************************************************************
+//
+//! @brief Initialize the Phase-Locked Loop (PLL).
+//!
+//! This function configures the system clock to 50 MHz from the PLL, with an
+//! input crystal frequency of 8 MHz and a system clock divider of 4.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void PLL_init(void)
+{
+	//
+	//	Bypass the PLL while initializing
+	//
+	SYSCTL_RCC_R |= SYSCTL_RCC_BYPASS;
+	SYSCTL_RCC_R &= ~SYSCTL_RCC_USESYSDIV;
+
+	//
+	//	Configure the crystal value (8 MHz) and oscillator source (MOSC)
+	//
+	SYSCTL_RCC_R &= ~(SYSCTL_RCC_XTAL_M | SYSCTL_RCC_OSCSRC_M);
+	SYSCTL_RCC_R |= SYSCTL_RCC_XTAL_8MHZ | SYSCTL_RCC_OSCSRC_MAIN;
+
+	//
+	//	Clear the PLL lock interrupt and activate the PLL
+	//
+	SYSCTL_MISC_R = SYSCTL_MISC_PLLLMIS;
+	SYSCTL_RCC_R &= ~SYSCTL_RCC_PWRDN;
+
+	//
+	//	Set the system divider (200 MHz / 4)
+	//
+	SYSCTL_RCC_R &= ~SYSCTL_RCC_SYSDIV_M;
+	SYSCTL_RCC_R |= (SYSCTL_SYSDIV_4 - 1) << SYSCTL_RCC_SYSDIV_S;
+	SYSCTL_RCC_R |= SYSCTL_RCC_USESYSDIV;
+
+	//
+	//	Wait until the PLL has locked
+	//
+	while((SYSCTL_RIS_R & SYSCTL_RIS_PLLLRIS) == 0){};
+
+	//
+	//	Enable use of the PLL
+	//
+	SYSCTL_RCC_R &= ~SYSCTL_RCC_BYPASS;
+}
@@ -0,0 +1,45 @@
+//*****************************************************************************
+//  semihost.h - ARM semihosting calls (QEMU -semihosting)
+//  Runs on LM3S6965 under QEMU
+//  Ronald Rodriguez Ruiz
+//  October 18, 2026
+//*****************************************************************************
+
+#ifndef __SEMIHOST_H__
+#define __SEMIHOST_H__
+
+//*****************************************************************************
+//
+//  The following are defines for the semihosting operations.
+//
+//*****************************************************************************
+
+#define SEMIHOST_SYS_WRITE0     0x04        // write a null-terminated string
+#define SEMIHOST_SYS_EXIT       0x18        // end the simulation
+#define SEMIHOST_SYS_ELAPSED    0x30        // 64-bit count of host ticks
+#define SEMIHOST_SYS_TICKFREQ   0x31        // frequency of the host ticks
+
+#define SEMIHOST_EXIT_SUCCESS   0x20026     // ADP_Stopped_ApplicationExit
+#define SEMIHOST_EXIT_FAILURE   0x20023     // ADP_Stopped_RunTimeErrorUnknown
+
+//*****************************************************************************
+//
+//! @brief Call the debugger/emulator (BKPT 0xAB).
+//!
+//! @param[in] op One of the SEMIHOST_SYS_xxx operations.
+//! @param[in] p_arg Operation specific argument.
+//!
+//! @return Operation specific result.
+//
+//*****************************************************************************
+static inline int32_t Semihost_call(int32_t op, const void *p_arg)
+{
+    register int32_t r0 __asm("r0") = op;
+    register const void *r1 __asm("r1") = p_arg;
+
+    __asm volatile ("bkpt 0xAB" : "+r" (r0) : "r" (r1) : "memory");
+
+    return r0;
+}
+
+#endif  // __SEMIHOST_H__
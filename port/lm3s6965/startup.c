@@ -0,0 +1,130 @@
+//*****************************************************************************
+//  startup.c - Vector table and reset handler for arm-none-eabi-gcc
+//  Runs on LM3S6965 (QEMU lm3s6965evb)
+//  Ronald Rodriguez Ruiz
+//  October 18, 2026
+//*****************************************************************************
+
+#include <stdint.h>
+
+//*****************************************************************************
+//
+//  The following are symbols defined by the linker script (lm3s6965.ld).
+//
+//*****************************************************************************
+
+extern uint32_t __data_load__, __data_start__, __data_end__;
+extern uint32_t __bss_start__, __bss_end__;
+extern uint32_t __stack_top__;
+
+//*****************************************************************************
+//
+//  Prototypes for the handlers.
+//
+//*****************************************************************************
+
+extern int main(void);
+extern void SysTick_Handler(void);      // "osasm_gcc.S"
+extern void Timer0A_Handler(void);      // "timer.c"
+extern void Timer1A_Handler(void);      // "swi.c"
+extern void WideTimer4A_Handler(void);  // "osasm_gcc.S"
+extern void WideTimer3A_Handler(void);  // "os.c"
+void Reset_Handler(void);
+static void Default_Handler(void);
+
+//*****************************************************************************
+//
+//  The vector table. Unused interrupts trap in Default_Handler.
+//
+//*****************************************************************************
+
+__attribute__((section(".vectors"), used))
+void (* const g_vectors[])(void) =
+{
+    (void (*)(void))&__stack_top__,     // initial stack pointer
+    Reset_Handler,                      // reset handler
+    Default_Handler,                    // NMI
+    Default_Handler,                    // hard fault
+    Default_Handler,                    // MPU fault
+    Default_Handler,                    // bus fault
+    Default_Handler,                    // usage fault
+    0, 0, 0, 0,                         // reserved
+    Default_Handler,                    // SVCall
+    Default_Handler,                    // debug monitor
+    0,                                  // reserved
+    Default_Handler,                    // PendSV
+    SysTick_Handler,                    // SysTick (context switch)
+    Default_Handler,                    // 0: GPIO port A
+    Default_Handler,                    // 1: GPIO port B
+    Default_Handler,                    // 2: GPIO port C
+    Default_Handler,                    // 3: GPIO port D
+    Default_Handler,                    // 4: GPIO port E
+    Default_Handler,                    // 5: UART0
+    Default_Handler,                    // 6: UART1
+    Default_Handler,                    // 7: SSI0
+    Default_Handler,                    // 8: I2C0
+    Default_Handler,                    // 9: PWM fault
+    Default_Handler,                    // 10: PWM generator 0
+    Default_Handler,                    // 11: PWM generator 1
+    Default_Handler,                    // 12: PWM generator 2
+    Default_Handler,                    // 13: quadrature encoder 0
+    Default_Handler,                    // 14: ADC sequence 0
+    Default_Handler,                    // 15: ADC sequence 1
+    Default_Handler,                    // 16: ADC sequence 2
+    Default_Handler,                    // 17: ADC sequence 3
+    Default_Handler,                    // 18: watchdog
+    Timer0A_Handler,                    // 19: timer 0A (kernel events)
+    Default_Handler,                    // 20: timer 0B
+    Timer1A_Handler,                    // 21: timer 1A (software interrupt)
+    Default_Handler,                    // 22: timer 1B
+    WideTimer4A_Handler,                // 23: timer 2A (profiler)
+    Default_Handler,                    // 24: timer 2B
+    Default_Handler,                    // 25: analog comparator 0
+    Default_Handler,                    // 26: analog comparator 1
+    Default_Handler,                    // 27: analog comparator 2
+    Default_Handler,                    // 28: system control
+    Default_Handler,                    // 29: flash control
+    Default_Handler,                    // 30: GPIO port F
+    Default_Handler,                    // 31: GPIO port G
+    Default_Handler,                    // 32: GPIO port H
+    Default_Handler,                    // 33: UART2
+    Default_Handler,                    // 34: SSI1
+    WideTimer3A_Handler,                // 35: timer 3A (high-resolution sleeps)
+    Default_Handler,                    // 36: timer 3B
+};
+
+//*****************************************************************************
+//
+//! @brief Reset handler.
+//!
+//! This function copies the initialized data from flash, clears the zero
+//! initialized data and calls main().
+//
+//*****************************************************************************
+void Reset_Handler(void)
+{
+    uint32_t *p_src = &__data_load__;
+    uint32_t *p_dst = &__data_start__;
+
+    while(p_dst < &__data_end__)
+    {
+        *p_dst++ = *p_src++;
+    }
+    for (p_dst = &__bss_start__; p_dst < &__bss_end__; p_dst++)
+    {
+        *p_dst = 0;
+    }
+
+    main();
+    while(1);
+}
+
+//*****************************************************************************
+//
+//! @brief Handler of the unexpected exceptions (stops for the debugger).
+//
+//*****************************************************************************
+static void Default_Handler(void)
+{
+    while(1);
+}
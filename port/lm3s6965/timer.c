@@ -0,0 +1,300 @@
+//*****************************************************************************
+//  timer.c - Software functions for Timers
+//  Runs on LM3S6965 (QEMU lm3s6965evb)
+//  Ronald Rodriguez Ruiz
+//  October 18, 2026
+//
+//  The LM3S6965 has no wide timers. The kernel event timer (Wide Timer5A on
+//  the TM4C123) is the 32-bit Timer0A, which has the same register map on
+//  both parts. Its vector (Timer0A_Handler) chains to WideTimer5A_Handler in
+//  "os.c", so the kernel is unaware of the substitution. The profiler timer
+//  (Wide Timer4A) is the Timer2A, whose vector is WideTimer4A_Handler itself
+//  (see "startup.c"), since it reads the exception frame. The one-shot of the
+//  high-resolution sleeps (Wide Timer3A) is the Timer3A.
+//
+//  The counter of the Timer0A reads as zero under QEMU, so its count is
+//  derived from the cycle counter (dwt.c) and the cycle stamp of the last
+//  timeout. Both timers run on the virtual clock of QEMU, so the stamp moves
+//  one period per timeout, and only a stamp off by a whole period is taken
+//  again from the cycle counter.
+//*****************************************************************************
+
+#include <stdint.h>
+#include "os_config.h"
+#include "timer.h"
+#include "dwt.h"
+#include "report.h"
+#include "console.h"
+#include "tm4c123gh6pm.h"
+
+//*****************************************************************************
+//
+//  The following is the define for the length of a run. QEMU ends after it
+//  with the task statistics printed over semihosting (0 runs forever).
+//
+//*****************************************************************************
+
+#ifndef PORT_RUN_MS
+#define PORT_RUN_MS             0
+#endif
+
+extern void WideTimer5A_Handler(void);
+
+static uint32_t g_period;               // reload value (core clock cycles)
+static uint32_t g_elapsed;              // elapsed core clock cycles (x1000)
+static uint32_t g_stamp;                // cycle counter at the last timeout
+
+//*****************************************************************************
+//
+//! @brief Initialize the Wide Timer5A (Timer0A on this part).
+//!
+//! @param[in] period Overflow period.
+//! @param[in] priority Interrupt priority level (from 0-7).
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Timer_WTimer5A_init(uint32_t period, uint8_t priority)
+{
+    g_period = period;
+    g_stamp = DWT_get_cycles();
+    //
+    //  Enable timer0 clock gating
+    //
+    SYSCTL_RCGC1_R |= SYSCTL_RCGC1_TIMER0;
+    //
+    //  Disable timer0A during setup
+    //
+    TIMER0_CTL_R &= ~TIMER_CTL_TAEN;
+    //
+    //  Set timer to 32-bit, periodic and count down mode
+    //
+    TIMER0_CFG_R = TIMER_CFG_32_BIT_TIMER;
+    TIMER0_TAMR_R = TIMER_TAMR_TAMR_PERIOD;
+    //
+    //  Set reload value
+    //
+    TIMER0_TAILR_R = period - 1;
+    //
+    //  Clear interrupt flag and arm interrupt
+    //
+    TIMER0_ICR_R = TIMER_ICR_TATOCINT;
+    TIMER0_IMR_R |= TIMER_IMR_TATOIM;
+    //
+    //  Set interrupt priority and enable irq 19 in NVIC
+    //
+    NVIC_PRI4_R = (NVIC_PRI4_R & ~NVIC_PRI4_INT19_M) |
+        (priority << NVIC_PRI4_INT19_S);
+    NVIC_EN0_R = 1 << 19;
+    //
+    //  Enable timer0A
+    //
+    TIMER0_CTL_R |= TIMER_CTL_TAEN;
+}
+
+//*****************************************************************************
+//
+//! @brief Clear the interrupt flag of the Wide Timer5A (Timer0A).
+//
+//*****************************************************************************
+void Timer_WTimer5A_clear_irq(void)
+{
+    TIMER0_ICR_R = TIMER_ICR_TATOCINT;
+}
+
+//*****************************************************************************
+//
+//! @brief Read the counter of the Wide Timer5A (Timer0A).
+//!
+//! The count is emulated (see above). A timeout whose handler has not run
+//! yet is taken into account, like the reload of the real counter.
+//
+//*****************************************************************************
+uint32_t Timer_WTimer5A_get_count(void)
+{
+    uint32_t elapsed = DWT_get_cycles() - g_stamp;
+
+    if(elapsed >= g_period)
+    {
+        elapsed -= g_period;
+    }
+    return elapsed < g_period ? g_period - 1 - elapsed : 0;
+}
+
+//*****************************************************************************
+//
+//! @brief Check if the Wide Timer5A (Timer0A) has timed out.
+//
+//*****************************************************************************
+uint32_t Timer_WTimer5A_expired(void)
+{
+    return TIMER0_RIS_R & TIMER_RIS_TATORIS;
+}
+
+//*****************************************************************************
+//
+//! @brief Change the period of the Wide Timer5A (Timer0A).
+//!
+//! The counter restarts from the new period, so the count since the last 
+//! timeout is dropped. The caller reads it first if it keeps the time.
+//!
+//! @param[in] period Overflow period.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Timer_WTimer5A_set_period(uint32_t period)
+{
+    g_period = period;
+    g_stamp = DWT_get_cycles();
+    TIMER0_TAILR_R = period - 1;
+}
+
+//*****************************************************************************
+//
+//! @brief IRQ Handler for the timer 0A.
+//!
+//! This handler ends the run after PORT_RUN_MS and otherwise runs the kernel
+//! event handler.
+//
+//*****************************************************************************
+void Timer0A_Handler(void)
+{
+    uint32_t now = DWT_get_cycles();
+
+    g_stamp += g_period;
+    if(now - g_stamp >= g_period)
+    {
+        g_stamp = now;
+    }
+#if PORT_RUN_MS
+    g_elapsed += g_period / 1000;
+    if(g_elapsed >= (uint32_t)PORT_RUN_MS * (CPU_CLOCK_FREQ / 1000000))
+    {
+        Report_task_stats();
+        Report_kernel_hist();
+        Report_irq_off();
+        Console_exit(0);
+    }
+#endif
+    WideTimer5A_Handler();
+}
+
+//*****************************************************************************
+//
+//! @brief Initialize the Wide Timer4A (Timer2A on this part).
+//!
+//! @param[in] period Overflow period.
+//! @param[in] priority Interrupt priority level (from 0-7).
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Timer_WTimer4A_init(uint32_t period, uint8_t priority)
+{
+    //
+    //  Enable timer2 clock gating
+    //
+    SYSCTL_RCGC1_R |= SYSCTL_RCGC1_TIMER2;
+    //
+    //  Disable timer2A during setup
+    //
+    TIMER2_CTL_R &= ~TIMER_CTL_TAEN;
+    //
+    //  Set timer to 32-bit, periodic and count down mode
+    //
+    TIMER2_CFG_R = TIMER_CFG_32_BIT_TIMER;
+    TIMER2_TAMR_R = TIMER_TAMR_TAMR_PERIOD;
+    //
+    //  Set reload value
+    //
+    TIMER2_TAILR_R = period - 1;
+    //
+    //  Clear interrupt flag and arm interrupt
+    //
+    TIMER2_ICR_R = TIMER_ICR_TATOCINT;
+    TIMER2_IMR_R |= TIMER_IMR_TATOIM;
+    //
+    //  Set interrupt priority and enable irq 23 in NVIC
+    //
+    NVIC_PRI5_R = (NVIC_PRI5_R & ~NVIC_PRI5_INT23_M) |
+        (priority << NVIC_PRI5_INT23_S);
+    NVIC_EN0_R = 1 << 23;
+    //
+    //  Enable timer2A
+    //
+    TIMER2_CTL_R |= TIMER_CTL_TAEN;
+}
+
+//*****************************************************************************
+//
+//! @brief Clear the interrupt flag of the Wide Timer4A (Timer2A).
+//
+//*****************************************************************************
+void Timer_WTimer4A_clear_irq(void)
+{
+    TIMER2_ICR_R = TIMER_ICR_TATOCINT;
+}
+
+//*****************************************************************************
+//
+//! @brief Initialize the Wide Timer3A (Timer3A on this part) as a one-shot.
+//!
+//! @param[in] priority Interrupt priority level (from 0-7).
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Timer_WTimer3A_init(uint8_t priority)
+{
+    //
+    //  Enable timer3 clock gating
+    //
+    SYSCTL_RCGC1_R |= SYSCTL_RCGC1_TIMER3;
+    //
+    //  Disable timer3A during setup
+    //
+    TIMER3_CTL_R &= ~TIMER_CTL_TAEN;
+    //
+    //  Set timer to 32-bit, one-shot and count down mode
+    //
+    TIMER3_CFG_R = TIMER_CFG_32_BIT_TIMER;
+    TIMER3_TAMR_R = TIMER_TAMR_TAMR_1_SHOT;
+    //
+    //  Clear interrupt flag and arm interrupt
+    //
+    TIMER3_ICR_R = TIMER_ICR_TATOCINT;
+    TIMER3_IMR_R |= TIMER_IMR_TATOIM;
+    //
+    //  Set interrupt priority and enable irq 35 in NVIC
+    //
+    NVIC_PRI8_R = (NVIC_PRI8_R & ~NVIC_PRI8_INT35_M) |
+        (priority << NVIC_PRI8_INT35_S);
+    NVIC_EN1_R = 1 << (35 - 32);
+}
+
+//*****************************************************************************
+//
+//! @brief Start the Wide Timer3A (Timer3A) one-shot.
+//!
+//! @param[in] period Time to the interrupt (core clock cycles, nonzero).
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Timer_WTimer3A_start(uint32_t period)
+{
+    TIMER3_CTL_R &= ~TIMER_CTL_TAEN;
+    TIMER3_TAILR_R = period - 1;
+    TIMER3_CTL_R |= TIMER_CTL_TAEN;
+}
+
+//*****************************************************************************
+//
+//! @brief Clear the interrupt flag of the Wide Timer3A (Timer3A).
+//
+//*****************************************************************************
+void Timer_WTimer3A_clear_irq(void)
+{
+    TIMER3_ICR_R = TIMER_ICR_TATOCINT;
+}
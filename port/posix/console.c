@@ -0,0 +1,32 @@
+//*****************************************************************************
+//  console.c - Text console for the POSIX (Linux host) port
+//  Runs on Linux
+//  Ronald Rodriguez Ruiz
+//  October 18, 2026
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "console.h"
+
+//*****************************************************************************
+//
+//! @brief Write a string to the standard output.
+//
+//*****************************************************************************
+void Console_write(const char *p_str)
+{
+    fputs(p_str, stdout);
+    fflush(stdout);
+}
+
+//*****************************************************************************
+//
+//! @brief End the process with the given status.
+//
+//*****************************************************************************
+void Console_exit(int32_t status)
+{
+    exit((int)status);
+}
@@ -0,0 +1,152 @@
+//*****************************************************************************
+//  cpu.c - Core functions for the POSIX (Linux host) port
+//  Runs on Linux
+//  Ronald Rodriguez Ruiz
+//  October 18, 2026
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "cpu.h"
+#include "port.h"
+
+//*****************************************************************************
+//
+//  The following is the pointer to the running task (defined in "os.c"). Only
+//  the first member of the TCB (sp) is used by the port.
+//
+//*****************************************************************************
+
+extern struct tcb *gp_running_task;
+
+//*****************************************************************************
+//
+//! @brief Disable interrupts.
+//
+//*****************************************************************************
+void CPU_disable_irq(void)
+{
+    Port_irq_mask();
+}
+
+//*****************************************************************************
+//
+//! @brief Enable interrupts.
+//!
+//! Interrupts that became pending while masked run before returning.
+//
+//*****************************************************************************
+void CPU_enable_irq(void)
+{
+    Port_irq_unmask();
+}
+
+//*****************************************************************************
+//
+//! @brief Sleep until an interrupt (WFI).
+//!
+//! The interrupts are signals, so the process sleeps until the next one. A
+//! signal that came just before is not counted, the wait then ends at the
+//! following one (the next tick at the latest).
+//
+//*****************************************************************************
+void CPU_wait_irq(void)
+{
+    pause();
+}
+
+//*****************************************************************************
+//
+//! @brief First code run by a task.
+//!
+//! A task is switched in for the first time from a handler, so it completes
+//! the exception return before calling the task function.
+//
+//*****************************************************************************
+static void task_start(void)
+{
+    struct port_context *p_ctx = PORT_CONTEXT(gp_running_task);
+
+    Port_irq_return();
+    p_ctx->p_task();
+
+    fprintf(stderr, "rtos: task %p returned\n", (void *)p_ctx);
+    abort();
+}
+
+//*****************************************************************************
+//
+//! @brief Build the initial context of a task.
+//!
+//! The kernel stack of the task is too small for the host C library, so the
+//! task runs on its own host stack and the kernel stack is left unused. The
+//! returned pointer is stored in the sp field of the TCB.
+//!
+//! @param[in] p_stack_top Pointer past the last word of the stack, or NULL
+//!            for the stack in use (unused).
+//! @param[in] p_task Pointer to the task function.
+//!
+//! @return Pointer to the context of the task.
+//
+//*****************************************************************************
+uint32_t *CPU_init_stack(uint32_t *p_stack_top, void (*p_task)(void))
+{
+    struct port_context *p_ctx;
+
+    (void)p_stack_top;
+
+    p_ctx = calloc(1, sizeof(struct port_context));
+    if(p_ctx == NULL || getcontext(&p_ctx->uc) != 0)
+    {
+        perror("rtos: CPU_init_stack");
+        exit(1);
+    }
+    p_ctx->p_stack = malloc(PORT_STACK_SIZE);
+    p_ctx->uc.uc_stack.ss_sp = p_ctx->p_stack;
+    p_ctx->uc.uc_stack.ss_size = PORT_STACK_SIZE;
+    p_ctx->uc.uc_link = NULL;
+    if(p_ctx->uc.uc_stack.ss_sp == NULL)
+    {
+        perror("rtos: CPU_init_stack");
+        exit(1);
+    }
+    p_ctx->p_task = p_task;
+    makecontext(&p_ctx->uc, task_start, 0);
+
+    return (uint32_t *)p_ctx;
+}
+
+//*****************************************************************************
+//
+//! @brief Build a new initial context for a task that has run.
+//!
+//! The task starts over on its own host stack, the earlier context is 
+//! dropped. It was saved in a handler, so the signals it had blocked are 
+//! cleared as in a context from CPU_init_stack.
+//!
+//! @param[in] p_sp Context of the task, from CPU_init_stack.
+//! @param[in] p_stack_top Pointer past the last word of the stack, or NULL
+//!            for the stack in use (unused).
+//! @param[in] p_task Pointer to the task function.
+//!
+//! @return Pointer to the context of the task.
+//
+//*****************************************************************************
+uint32_t *CPU_restart_stack(uint32_t *p_sp, uint32_t *p_stack_top, 
+    void (*p_task)(void))
+{
+    struct port_context *p_ctx = (struct port_context *)p_sp;
+
+    (void)p_stack_top;
+
+    p_ctx->uc.uc_stack.ss_sp = p_ctx->p_stack;
+    p_ctx->uc.uc_stack.ss_size = PORT_STACK_SIZE;
+    p_ctx->uc.uc_link = NULL;
+    sigemptyset(&p_ctx->uc.uc_sigmask);
+    p_ctx->p_task = p_task;
+    makecontext(&p_ctx->uc, task_start, 0);
+
+    return p_sp;
+}
@@ -0,0 +1,41 @@
+//*****************************************************************************
+//  dwt.c - Cycle counter for the POSIX (Linux host) port
+//  Runs on Linux
+//  Ronald Rodriguez Ruiz
+//  October 18, 2026
+//*****************************************************************************
+
+#include <stdint.h>
+#include "os_config.h"
+#include "dwt.h"
+#include "port.h"
+
+static uint64_t g_start_ns;
+
+//*****************************************************************************
+//
+//! @brief Initialize the cycle counter.
+//!
+//! The counter is emulated from the monotonic host clock and counts at
+//! CPU_CLOCK_FREQ, so intervals have the same units as on the target.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void DWT_init(void)
+{
+    g_start_ns = Port_get_ns();
+}
+
+//*****************************************************************************
+//
+//! @brief Read the cycle counter.
+//!
+//! @return Number of emulated core clock cycles elapsed since DWT_init().
+//
+//*****************************************************************************
+uint32_t DWT_get_cycles(void)
+{
+    return (uint32_t)((Port_get_ns() - g_start_ns) * (CPU_CLOCK_FREQ / 1000000)
+        / 1000);
+}
@@ -0,0 +1,485 @@
+//*****************************************************************************
+//  nvic.c - Interrupt controller emulation for the POSIX (Linux host) port
+//  Runs on Linux
+//  Ronald Rodriguez Ruiz
+//  October 18, 2026
+//
+//  The interrupts of the target are emulated inside a single Linux thread.
+//  Periodic sources (SysTick, WTimer5A) are POSIX timers that deliver
+//  SIGALRM. The signal handler marks the interrupt as pending and, unless
+//  interrupts are masked (CPU_disable_irq) or a handler is already running,
+//  runs the pending handlers by priority, like the NVIC tail-chaining them.
+//  Handlers may switch tasks, so the code after a handler returns is the
+//  "exception return" of whichever task is resumed.
+//
+//  The host PC that each SIGALRM interrupts is kept (Port_irq_pc) as the
+//  stacked PC of an exception frame, for the profiler.
+//*****************************************************************************
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
+#include "os.h"
+#include "trace.h"
+#include "report.h"
+#include "profile.h"
+#include "console.h"
+#include "port.h"
+
+//*****************************************************************************
+//
+//  The following is defined by the linker: the first byte of the executable.
+//  The sampled PCs are offsets from it, so that they are symbolized from the
+//  ELF whatever address the executable is loaded at.
+//
+//*****************************************************************************
+
+extern const char __executable_start[];
+
+//*****************************************************************************
+//
+//  This data structure defines an emulated interrupt.
+//
+//*****************************************************************************
+
+struct irq
+{
+    volatile sig_atomic_t pending;  // set by the source, cleared on entry
+    uint8_t priority;               // 0 is highest, 7 is lowest
+    void (*p_handler)(void);        // NULL until enabled
+    timer_t timer;                  // periodic source (if any)
+    bool has_timer;
+};
+
+//*****************************************************************************
+//
+//  The following are global definitions for the emulated core state.
+//
+//*****************************************************************************
+
+static struct irq g_irqs[PORT_NUM_IRQS];
+static volatile sig_atomic_t g_primask;     // 1 if interrupts are masked
+static volatile sig_atomic_t g_in_handler;  // 1 while a handler runs
+static volatile sig_atomic_t g_stop;        // run time limit reached
+static volatile uint32_t g_irq_pc;          // PC interrupted by SIGALRM
+static uint64_t g_stop_ns;                  // 0 means run forever
+static bool g_initialized;
+
+//*****************************************************************************
+//
+//! @brief Print the task statistics and dump the trace buffer.
+//!
+//! This function runs at the end of a time-limited run (RTOS_RUN_MS). The
+//! trace buffer is written to RTOS_TRACE_FILE, if set, with the same layout
+//! that a debugger dump of g_trace has on the target. The kernel histograms
+//! are written to RTOS_HIST_FILE, if set, as exported blobs (hist.h) one 
+//! after the other: scheduler, wake and ISR. The profile buffer is written 
+//! to RTOS_PROFILE_FILE, if set, in the same way as the trace buffer.
+//!
+//! @return None.
+//
+//*****************************************************************************
+static void port_exit(void)
+{
+#if OS_CFG_TRACE || OS_CFG_HIST || OS_CFG_PROFILE
+    const char *p_path;
+    FILE *p_file;
+#endif
+
+    Report_task_stats();
+    Report_kernel_hist();
+    Report_irq_off();
+#if OS_CFG_TRACE
+    p_path = getenv("RTOS_TRACE_FILE");
+    if(p_path != NULL && (p_file = fopen(p_path, "wb")) != NULL)
+    {
+        fwrite(&g_trace, sizeof(g_trace), 1, p_file);
+        fclose(p_file);
+    }
+#endif
+#if OS_CFG_HIST
+    static uint8_t blob[HIST_EXPORT_SIZE];
+    const struct hist *p_hists[] = {&g_hist_sched, &g_hist_wake, &g_hist_isr};
+    uint8_t i;
+
+    p_path = getenv("RTOS_HIST_FILE");
+    if(p_path != NULL && (p_file = fopen(p_path, "wb")) != NULL)
+    {
+        for (i = 0; i < 3; i++)
+        {
+            fwrite(blob, Hist_export(p_hists[i], blob, sizeof(blob)), 1, 
+                p_file);
+        }
+        fclose(p_file);
+    }
+#endif
+#if OS_CFG_PROFILE
+    p_path = getenv("RTOS_PROFILE_FILE");
+    if(p_path != NULL && (p_file = fopen(p_path, "wb")) != NULL)
+    {
+        fwrite(&g_profile, sizeof(g_profile), 1, p_file);
+        fclose(p_file);
+    }
+#endif
+    Console_exit(0);
+}
+
+//*****************************************************************************
+//
+//! @brief Run the pending handlers.
+//!
+//! This function runs in handler mode, by priority, every pending interrupt.
+//! It returns when none is left. A handler can switch to another task, in
+//! which case this function keeps going in the context of that task.
+//!
+//! @return None.
+//
+//*****************************************************************************
+static void run_handlers(void)
+{
+    uint8_t i;
+    int best;
+
+    while(1)
+    {
+        if(g_stop)
+        {
+            port_exit();
+        }
+
+        best = -1;
+        for (i = 0; i < PORT_NUM_IRQS; i++)
+        {
+            if(g_irqs[i].pending && g_irqs[i].p_handler &&
+                (best < 0 || g_irqs[i].priority < g_irqs[best].priority))
+            {
+                best = i;
+            }
+        }
+        if(best < 0)
+        {
+            return;
+        }
+
+        g_irqs[best].pending = 0;
+        g_irqs[best].p_handler();
+    }
+}
+
+//*****************************************************************************
+//
+//! @brief Check if there is an interrupt waiting to be handled.
+//
+//*****************************************************************************
+static bool any_pending(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < PORT_NUM_IRQS; i++)
+    {
+        if(g_irqs[i].pending && g_irqs[i].p_handler)
+        {
+            return true;
+        }
+    }
+    return g_stop != 0;
+}
+
+//*****************************************************************************
+//
+//! @brief Enter handler mode and run the pending handlers.
+//
+//*****************************************************************************
+static void dispatch(void)
+{
+    Port_irq_enter();
+    Port_irq_return();
+}
+
+//*****************************************************************************
+//
+//! @brief SIGALRM handler (interrupt line of the periodic sources).
+//
+//*****************************************************************************
+static void on_alarm(int sig, siginfo_t *p_info, void *p_uc)
+{
+    (void)sig;
+
+#if defined(__x86_64__)
+    g_irq_pc = (uint32_t)(((ucontext_t *)p_uc)->uc_mcontext.gregs[REG_RIP] -
+        (uintptr_t)__executable_start);
+#elif defined(__aarch64__)
+    g_irq_pc = (uint32_t)(((ucontext_t *)p_uc)->uc_mcontext.pc -
+        (uintptr_t)__executable_start);
+#else
+    (void)p_uc;
+#endif
+    if(p_info->si_code == SI_TIMER)
+    {
+        g_irqs[p_info->si_value.sival_int].pending = 1;
+    }
+    if(g_stop_ns && Port_get_ns() >= g_stop_ns)
+    {
+        g_stop = 1;
+    }
+    if(!g_primask && !g_in_handler)
+    {
+        dispatch();
+    }
+}
+
+//*****************************************************************************
+//
+//! @brief Initialize the port.
+//!
+//! This function installs the SIGALRM handler and reads the optional run time
+//! limit (RTOS_RUN_MS, in milliseconds) from the environment.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Port_init(void)
+{
+    struct sigaction sa;
+    const char *p_limit;
+
+    if(g_initialized)
+    {
+        return;
+    }
+    g_initialized = true;
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_sigaction = on_alarm;
+    sa.sa_flags = SA_SIGINFO | SA_RESTART;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGALRM, &sa, NULL);
+
+    p_limit = getenv("RTOS_RUN_MS");
+    if(p_limit != NULL && atol(p_limit) > 0)
+    {
+        g_stop_ns = Port_get_ns() + (uint64_t)atol(p_limit) * 1000000;
+    }
+}
+
+//*****************************************************************************
+//
+//! @brief Enable an interrupt.
+//!
+//! @param[in] irq One of the PORT_IRQ_xxx interrupts.
+//! @param[in] priority Interrupt priority level (from 0-7).
+//! @param[in] p_handler Interrupt handler.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Port_irq_init(uint8_t irq, uint8_t priority, void (*p_handler)(void))
+{
+    Port_init();
+    g_irqs[irq].priority = priority;
+    g_irqs[irq].p_handler = p_handler;
+}
+
+//*****************************************************************************
+//
+//! @brief Set an interrupt pending.
+//!
+//! Software triggered interrupts (e.g. SysTick_set_pending) run right away
+//! when called from a task with interrupts enabled, as on the target.
+//!
+//! @param[in] irq One of the PORT_IRQ_xxx interrupts.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Port_irq_pend(uint8_t irq)
+{
+    g_irqs[irq].pending = 1;
+    if(!g_primask && !g_in_handler)
+    {
+        dispatch();
+    }
+}
+
+//*****************************************************************************
+//
+//! @brief Check if an interrupt is pending.
+//!
+//! @param[in] irq One of the PORT_IRQ_xxx interrupts.
+//!
+//! @return Nonzero if the interrupt is waiting to be handled.
+//
+//*****************************************************************************
+uint32_t Port_irq_pending(uint8_t irq)
+{
+    return g_irqs[irq].pending;
+}
+
+//*****************************************************************************
+//
+//! @brief Mask and unmask the interrupts (PRIMASK).
+//
+//*****************************************************************************
+void Port_irq_mask(void)
+{
+    g_primask = 1;
+    __atomic_signal_fence(__ATOMIC_SEQ_CST);
+}
+
+void Port_irq_unmask(void)
+{
+    __atomic_signal_fence(__ATOMIC_SEQ_CST);
+    g_primask = 0;
+    if(!g_in_handler && any_pending())
+    {
+        dispatch();
+    }
+}
+
+//*****************************************************************************
+//
+//! @brief Enter handler mode.
+//!
+//! Used by run_os() to start the first task as an exception return.
+//
+//*****************************************************************************
+void Port_irq_enter(void)
+{
+    g_in_handler = 1;
+}
+
+//*****************************************************************************
+//
+//! @brief Return from handler mode into the running task.
+//!
+//! This function tail-chains any interrupt that became pending while the
+//! handlers ran, then leaves handler mode. It is also the first code that a
+//! new task runs (see CPU_init_stack).
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Port_irq_return(void)
+{
+    run_handlers();
+    g_in_handler = 0;
+
+    // an interrupt raised after the last check is handled right away
+    if(!g_primask && any_pending())
+    {
+        dispatch();
+    }
+}
+
+//*****************************************************************************
+//
+//! @brief Arm the timer of an interrupt.
+//!
+//! @param[in] irq One of the PORT_IRQ_xxx interrupts.
+//! @param[in] period Period in core clock cycles (CPU_CLOCK_FREQ), 0 stops it.
+//! @param[in] periodic False for a one-shot.
+//!
+//! @return None.
+//
+//*****************************************************************************
+static void timer_arm(uint8_t irq, uint32_t period, bool periodic)
+{
+    struct sigevent sev;
+    struct itimerspec its;
+    uint64_t ns = (uint64_t)period * 1000000000 / CPU_CLOCK_FREQ;
+
+    Port_init();
+    if(!g_irqs[irq].has_timer)
+    {
+        memset(&sev, 0, sizeof(sev));
+        sev.sigev_notify = SIGEV_SIGNAL;
+        sev.sigev_signo = SIGALRM;
+        sev.sigev_value.sival_int = irq;
+        if(timer_create(CLOCK_MONOTONIC, &sev, &g_irqs[irq].timer) != 0)
+        {
+            perror("timer_create");
+            exit(1);
+        }
+        g_irqs[irq].has_timer = true;
+    }
+
+    its.it_value.tv_sec = ns / 1000000000;
+    its.it_value.tv_nsec = ns % 1000000000;
+    its.it_interval = its.it_value;
+    if(!periodic)
+    {
+        its.it_interval.tv_sec = 0;
+        its.it_interval.tv_nsec = 0;
+        // a zero it_value would disarm the timer
+        if(period != 0 && ns == 0)
+        {
+            its.it_value.tv_nsec = 1;
+        }
+    }
+    timer_settime(g_irqs[irq].timer, 0, &its, NULL);
+}
+
+//*****************************************************************************
+//
+//! @brief Start the periodic source of an interrupt.
+//!
+//! @param[in] irq One of the PORT_IRQ_xxx interrupts.
+//! @param[in] period Period in core clock cycles (CPU_CLOCK_FREQ), 0 stops it.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Port_timer_start(uint8_t irq, uint32_t period)
+{
+    timer_arm(irq, period, true);
+}
+
+//*****************************************************************************
+//
+//! @brief Start the one-shot source of an interrupt.
+//!
+//! The previous count is cancelled if it has not expired yet.
+//!
+//! @param[in] irq One of the PORT_IRQ_xxx interrupts.
+//! @param[in] period Time to the interrupt in core clock cycles, 0 stops it.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Port_timer_once(uint8_t irq, uint32_t period)
+{
+    timer_arm(irq, period, false);
+}
+
+//*****************************************************************************
+//
+//! @brief Read the PC interrupted by the last SIGALRM.
+//!
+//! @return Offset of the PC from the start of the executable (0 if the host
+//!         architecture is not supported).
+//
+//*****************************************************************************
+uint32_t Port_irq_pc(void)
+{
+    return g_irq_pc;
+}
+
+//*****************************************************************************
+//
+//! @brief Read the monotonic host time.
+//!
+//! @return Nanoseconds since an arbitrary point.
+//
+//*****************************************************************************
+uint64_t Port_get_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
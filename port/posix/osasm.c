@@ -0,0 +1,79 @@
+//*****************************************************************************
+//  osasm.c - Context switch for the POSIX (Linux host) port
+//  Runs on Linux
+//  Ronald Rodriguez Ruiz
+//  October 18, 2026
+//
+//  Host equivalent of "osasm.s": SysTick_Handler saves the context of the
+//  running task, calls the scheduler and resumes the chosen task. Contexts
+//  are switched with swapcontext() instead of pushing R4-R11.
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "cpu.h"
+#include "port.h"
+#include "profile.h"
+
+//*****************************************************************************
+//
+//  The following are defined in "os.c".
+//
+//*****************************************************************************
+
+extern struct tcb *gp_running_task;
+extern void scheduler(void);
+
+//*****************************************************************************
+//
+//! @brief SysTick interrupt handler (context switch).
+//
+//*****************************************************************************
+void SysTick_Handler(void)
+{
+    struct tcb *p_old = gp_running_task;
+
+    CPU_disable_irq();
+    scheduler();
+    CPU_enable_irq();
+
+    if(gp_running_task != p_old)
+    {
+        swapcontext(&PORT_CONTEXT(p_old)->uc,
+            &PORT_CONTEXT(gp_running_task)->uc);
+    }
+}
+
+//*****************************************************************************
+//
+//! @brief Start the first task.
+//!
+//! As on the target, the first task is entered as if returning from an
+//! exception, with interrupts enabled. This function never returns.
+//
+//*****************************************************************************
+void run_os(void)
+{
+    Port_irq_enter();
+    CPU_enable_irq();
+    setcontext(&PORT_CONTEXT(gp_running_task)->uc);
+
+    perror("rtos: run_os");
+    exit(1);
+}
+
+//*****************************************************************************
+//
+//! @brief Wide Timer4A interrupt handler (profiler tick).
+//!
+//! On the target the PC is read from the exception frame; here it is the
+//! host PC that the SIGALRM interrupted (see Port_irq_pc).
+//
+//*****************************************************************************
+void WideTimer4A_Handler(void)
+{
+#if OS_CFG_PROFILE
+    Profile_sample(Port_irq_pc());
+#endif
+}
@@ -0,0 +1,25 @@
+//*****************************************************************************
+//  pll.c - Clock setup for the POSIX (Linux host) port
+//  Runs on Linux
+//  Ronald Rodriguez Ruiz
+//  October 18, 2026
+//*****************************************************************************
+
+#include <stdint.h>
+#include "pll.h"
+#include "port.h"
+
+//*****************************************************************************
+//
+//! @brief Initialize the Phase-Locked Loop (PLL).
+//!
+//! The host clock needs no setup. This is the first call of OS_start(), so it
+//! initializes the port (interrupt emulation and run time limit).
+//!
+//! @return None.
+//
+//*****************************************************************************
+void PLL_init(void)
+{
+    Port_init();
+}
@@ -0,0 +1,67 @@
+//*****************************************************************************
+//  port.h - Prototypes for the POSIX (Linux host) port
+//  Runs on Linux
+//  Ronald Rodriguez Ruiz
+//  October 18, 2026
+//*****************************************************************************
+
+#ifndef __PORT_H__
+#define __PORT_H__
+
+#include <signal.h>
+#include <ucontext.h>
+
+//*****************************************************************************
+//
+//  The following are defines for the emulated interrupts. Each one stands in
+//  for an NVIC/system exception of the TM4C123 and has its own priority
+//  (0 is highest, 7 is lowest).
+//
+//*****************************************************************************
+
+#define PORT_IRQ_WTIMER5A       0           // WideTimer5A_Handler
+#define PORT_IRQ_SYSTICK        1           // SysTick_Handler
+#define PORT_IRQ_SWI            2           // software interrupt (swi.h)
+#define PORT_IRQ_WTIMER4A       3           // WideTimer4A_Handler (profiler)
+#define PORT_IRQ_WTIMER3A       4           // WideTimer3A_Handler (one-shot)
+#define PORT_NUM_IRQS           5
+
+#define PORT_STACK_SIZE         (64 * 1024) // host stack per task (bytes)
+
+//*****************************************************************************
+//
+//  This data structure defines the context of a task. The first member of the
+//  TCB (sp) points to it, in the same way that it points to the saved
+//  registers on the target.
+//
+//*****************************************************************************
+
+struct port_context
+{
+    ucontext_t uc;              // saved registers and host stack
+    void (*p_task)(void);       // task function
+    void *p_stack;              // host stack (see CPU_restart_stack)
+};
+
+#define PORT_CONTEXT(p_tcb)     (*(struct port_context **)(p_tcb))
+
+//*****************************************************************************
+//
+//  Prototypes for the port layer (nvic.c)
+//
+//*****************************************************************************
+
+extern void Port_init(void);
+extern void Port_irq_init(uint8_t irq, uint8_t priority, void (*p_handler)(void));
+extern void Port_irq_pend(uint8_t irq);
+extern uint32_t Port_irq_pending(uint8_t irq);
+extern void Port_irq_mask(void);
+extern void Port_irq_unmask(void);
+extern void Port_irq_enter(void);
+extern void Port_irq_return(void);
+extern void Port_timer_start(uint8_t irq, uint32_t period);
+extern void Port_timer_once(uint8_t irq, uint32_t period);
+extern uint64_t Port_get_ns(void);
+extern uint32_t Port_irq_pc(void);
+
+#endif  // __PORT_H__
@@ -0,0 +1,53 @@
+//*****************************************************************************
+//  swi.c - Software interrupt for the POSIX (Linux host) port
+//  Runs on Linux
+//  Ronald Rodriguez Ruiz
+//  October 18, 2026
+//*****************************************************************************
+
+#include <stdint.h>
+#include "swi.h"
+#include "port.h"
+
+//*****************************************************************************
+//
+//! @brief Initialize the software interrupt.
+//!
+//! @param[in] p_handler Interrupt handler.
+//! @param[in] priority Interrupt priority level (from 0-7).
+//!
+//! @return None.
+//
+//*****************************************************************************
+void SWI_init(void (*p_handler)(void), uint8_t priority)
+{
+    Port_irq_init(PORT_IRQ_SWI, priority, p_handler);
+}
+
+//*****************************************************************************
+//
+//! @brief Raise the software interrupt.
+//!
+//! When called from a task, the handler runs before this function returns.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void SWI_trigger(void)
+{
+    Port_irq_pend(PORT_IRQ_SWI);
+}
+
+//*****************************************************************************
+//
+//! @brief Raise the software interrupt periodically.
+//!
+//! @param[in] period Overflow period (core clock cycles).
+//!
+//! @return None.
+//
+//*****************************************************************************
+void SWI_start_timer(uint32_t period)
+{
+    Port_timer_start(PORT_IRQ_SWI, period);
+}
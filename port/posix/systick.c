@@ -0,0 +1,126 @@
+//*****************************************************************************
+//  systick.c - System Timer for the POSIX (Linux host) port
+//  Runs on Linux
+//  Ronald Rodriguez Ruiz
+//  October 18, 2026
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "os_config.h"
+#include "systick.h"
+#include "port.h"
+
+//*****************************************************************************
+//
+//  The following is the interrupt handler of the SysTick ("osasm.c").
+//
+//*****************************************************************************
+
+extern void SysTick_Handler(void);
+
+static uint32_t g_period;               // reload value (core clock cycles)
+static bool g_irq_enabled;
+
+//*****************************************************************************
+//
+//! @brief Busy wait a number of nanoseconds.
+//
+//*****************************************************************************
+static void busy_wait(uint64_t ns)
+{
+    uint64_t end = Port_get_ns() + ns;
+
+    while(Port_get_ns() < end);
+}
+
+//*****************************************************************************
+//
+//! @brief Initialize the System Timer (SysTick).
+//!
+//! @param[in] period Overflow period (core clock cycles).
+//! @param[in] irq_enabled Flag to enable the SysTick interrupt.
+//! @param[in] priority Interrupt priority level (from 0-7).
+//!
+//! @return None.
+//
+//*****************************************************************************
+void SysTick_init(uint32_t period, bool irq_enabled, uint8_t priority)
+{
+    g_period = period;
+    g_irq_enabled = irq_enabled;
+
+    //
+    //  The handler is always installed so that SysTick_set_pending() works,
+    //  the periodic source only runs if requested
+    //
+    Port_irq_init(PORT_IRQ_SYSTICK, priority, SysTick_Handler);
+    if(irq_enabled)
+    {
+        Port_timer_start(PORT_IRQ_SYSTICK, period);
+    }
+}
+
+//*****************************************************************************
+//
+//! @brief Initialize the SysTick interrupt as a software interrupt.
+//!
+//! @param[in] priority Interrupt priority level (from 0-7).
+//!
+//! @return None.
+//
+//*****************************************************************************
+void SysTick_init_soft(uint8_t priority)
+{
+    g_irq_enabled = false;
+    Port_irq_init(PORT_IRQ_SYSTICK, priority, SysTick_Handler);
+}
+
+//*****************************************************************************
+//
+//! @brief Wait one SysTick period.
+//
+//*****************************************************************************
+void SysTick_wait(void)
+{
+    busy_wait((uint64_t)g_period * 1000000000 / CPU_CLOCK_FREQ);
+}
+
+//*****************************************************************************
+//
+//! @brief Delays program execution (milliseconds).
+//
+//*****************************************************************************
+void SysTick_delay_ms(uint32_t ms)
+{
+    busy_wait((uint64_t)ms * 1000000);
+}
+
+//*****************************************************************************
+//
+//! @brief Delays program execution (microseconds).
+//
+//*****************************************************************************
+void SysTick_delay_us(uint32_t us)
+{
+    busy_wait((uint64_t)us * 1000);
+}
+
+//*****************************************************************************
+//
+//! @brief Trigger the SysTick interrupt.
+//!
+//! As on the target, the counter restarts so the next task gets a full time
+//! slice.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void SysTick_set_pending(void)
+{
+    if(g_irq_enabled)
+    {
+        Port_timer_start(PORT_IRQ_SYSTICK, g_period);
+    }
+    Port_irq_pend(PORT_IRQ_SYSTICK);
+}
@@ -0,0 +1,188 @@
+//*****************************************************************************
+//  timer.c - Timers for the POSIX (Linux host) port
+//  Runs on Linux
+//  Ronald Rodriguez Ruiz
+//  October 18, 2026
+//*****************************************************************************
+
+#include <stdint.h>
+#include "os_config.h"
+#include "timer.h"
+#include "port.h"
+
+//*****************************************************************************
+//
+//  The following are the interrupt handlers of the wide timers 5A and 3A 
+//  ("os.c") and of the wide timer 4A ("osasm.c").
+//
+//*****************************************************************************
+
+extern void WideTimer5A_Handler(void);
+extern void WideTimer4A_Handler(void);
+extern void WideTimer3A_Handler(void);
+
+//*****************************************************************************
+//
+//  The following are global definitions for the emulated counter of the 
+//  wide timer 5A. It restarts when the handler clears the flag, so that it
+//  is in phase with the (late) delivery of the host signal.
+//
+//*****************************************************************************
+
+static uint32_t g_wt5_period;           // reload value (core clock cycles)
+static uint64_t g_wt5_reload_ns;        // host time of the last reload
+
+//*****************************************************************************
+//
+//! @brief Initialize the Wide Timer5A.
+//!
+//! @param[in] period Overflow period (core clock cycles).
+//! @param[in] priority Interrupt priority level (from 0-7).
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Timer_WTimer5A_init(uint32_t period, uint8_t priority)
+{
+    g_wt5_period = period;
+    g_wt5_reload_ns = Port_get_ns();
+    Port_irq_init(PORT_IRQ_WTIMER5A, priority, WideTimer5A_Handler);
+    Port_timer_start(PORT_IRQ_WTIMER5A, period);
+}
+
+//*****************************************************************************
+//
+//! @brief Clear the Wide Timer5A interrupt flag.
+//!
+//! The emulated interrupt is cleared on entry, only the counter restarts.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Timer_WTimer5A_clear_irq(void)
+{
+    g_wt5_reload_ns = Port_get_ns();
+}
+
+//*****************************************************************************
+//
+//! @brief Read the counter of the Wide Timer5A.
+//!
+//! The counter stops at 0 until the signal comes, and is reloaded from then
+//! until the handler runs, so that the time read never goes backwards when
+//! the signal comes late.
+//!
+//! @return Current value (counts down from the period - 1 to 0).
+//
+//*****************************************************************************
+uint32_t Timer_WTimer5A_get_count(void)
+{
+    uint64_t cycles = (Port_get_ns() - g_wt5_reload_ns) * 
+        (CPU_CLOCK_FREQ / 1000000) / 1000;
+
+    if(Port_irq_pending(PORT_IRQ_WTIMER5A))
+    {
+        return g_wt5_period - 1;
+    }
+    return cycles < g_wt5_period ? g_wt5_period - 1 - (uint32_t)cycles : 0;
+}
+
+//*****************************************************************************
+//
+//! @brief Check if the Wide Timer5A has timed out.
+//!
+//! @return Nonzero if the interrupt is pending.
+//
+//*****************************************************************************
+uint32_t Timer_WTimer5A_expired(void)
+{
+    return Port_irq_pending(PORT_IRQ_WTIMER5A);
+}
+
+//*****************************************************************************
+//
+//! @brief Change the period of the Wide Timer5A.
+//!
+//! The host timer is re-armed, so the counter restarts from the new period.
+//!
+//! @param[in] period Overflow period (core clock cycles).
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Timer_WTimer5A_set_period(uint32_t period)
+{
+    g_wt5_period = period;
+    g_wt5_reload_ns = Port_get_ns();
+    Port_timer_start(PORT_IRQ_WTIMER5A, period);
+}
+
+//*****************************************************************************
+//
+//! @brief Initialize the Wide Timer4A.
+//!
+//! @param[in] period Overflow period (core clock cycles).
+//! @param[in] priority Interrupt priority level (from 0-7).
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Timer_WTimer4A_init(uint32_t period, uint8_t priority)
+{
+    Port_irq_init(PORT_IRQ_WTIMER4A, priority, WideTimer4A_Handler);
+    Port_timer_start(PORT_IRQ_WTIMER4A, period);
+}
+
+//*****************************************************************************
+//
+//! @brief Clear the Wide Timer4A interrupt flag.
+//!
+//! The emulated interrupt is cleared on entry, nothing to do.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Timer_WTimer4A_clear_irq(void)
+{
+}
+
+//*****************************************************************************
+//
+//! @brief Initialize the Wide Timer3A as a one-shot.
+//!
+//! @param[in] priority Interrupt priority level (from 0-7).
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Timer_WTimer3A_init(uint8_t priority)
+{
+    Port_irq_init(PORT_IRQ_WTIMER3A, priority, WideTimer3A_Handler);
+}
+
+//*****************************************************************************
+//
+//! @brief Start the Wide Timer3A one-shot.
+//!
+//! @param[in] period Time to the interrupt (core clock cycles, nonzero).
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Timer_WTimer3A_start(uint32_t period)
+{
+    Port_timer_once(PORT_IRQ_WTIMER3A, period);
+}
+
+//*****************************************************************************
+//
+//! @brief Clear the Wide Timer3A interrupt flag.
+//!
+//! The emulated interrupt is cleared on entry, nothing to do.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Timer_WTimer3A_clear_irq(void)
+{
+}
@@ -0,0 +1,118 @@
+//*****************************************************************************
+//
+//  PC-sampling profiler for the OS kernel.
+//  File: 		profile.c
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//*****************************************************************************
+//*****************************************************************************
+//
+//  The following are header files for the C standard library.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+
+//*****************************************************************************
+//
+//  This is the application header file.
+//
+//*****************************************************************************
+
+#include "os.h"
+#include "profile.h"
+
+//*****************************************************************************
+//
+//  The following are header files for the TM4C123G driver library.
+//
+//*****************************************************************************
+
+#include "timer.h"
+
+#if OS_CFG_PROFILE
+
+#if (OS_CFG_PROFILE_SIZE & PROFILE_MASK) != 0
+#error "OS_CFG_PROFILE_SIZE must be a power of two"
+#endif
+
+//*****************************************************************************
+//
+//  The following is the global definition of the profile buffer. It is 
+//  found by the debugger through its symbol, so it must not be static.
+//
+//*****************************************************************************
+
+struct profile_buffer g_profile = 
+{
+	.magic = PROFILE_MAGIC,
+	.version = PROFILE_VERSION,
+	.size = OS_CFG_PROFILE_SIZE,
+	.freq = OS_CFG_PROFILE_FREQ,
+	.samples = 0,
+	.dropped = 0
+};
+
+//*****************************************************************************
+//
+//! @brief Start the profiler.
+//!
+//! This function starts the Wide Timer4A at OS_CFG_PROFILE_FREQ with the 
+//! highest priority (0), so that SysTick_Handler is sampled as well (the 
+//! kernel event ISR has the same priority and is not). It is called by 
+//! OS_start().
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Profile_init(void)
+{
+	Timer_WTimer4A_init(CPU_CLOCK_FREQ / OS_CFG_PROFILE_FREQ, 0);
+}
+
+//*****************************************************************************
+//
+//! @brief Count a sample.
+//!
+//! This function is called by WideTimer4A_Handler with the interrupted PC. 
+//! The slot of the PC (within the running task) is found by hashing with 
+//! linear probing, so a sample costs a few tens of cycles.
+//!
+//! @param[in] pc Program counter stacked on exception entry.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Profile_sample(uint32_t pc)
+{
+	uint32_t i, idx;
+	uint16_t task = OS_get_task_id();
+	struct profile_slot *p_slot;
+
+	Timer_WTimer4A_clear_irq();
+	g_profile.samples++;
+
+	// Fibonacci hashing of the PC (instructions are at least 2 bytes)
+	idx = (((pc >> 1) * 2654435761u) >> 16) + task;
+	for (i = 0; i < PROFILE_PROBES; i++)
+	{
+		p_slot = &g_profile.slots[(idx + i) & PROFILE_MASK];
+		if(p_slot->hits == 0)
+		{
+			p_slot->pc = pc;
+			p_slot->task = task;
+			p_slot->hits = 1;
+			return;
+		}
+		if(p_slot->pc == pc && p_slot->task == task)
+		{
+			p_slot->hits++;
+			return;
+		}
+	}
+	g_profile.dropped++;
+}
+
+#endif	// OS_CFG_PROFILE
@@ -0,0 +1,81 @@
+//*****************************************************************************
+//
+//  Prototypes and data structures for the PC-sampling profiler.
+//  File: 		profile.h
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//  The Wide Timer4A interrupts the CPU OS_CFG_PROFILE_FREQ times per second.
+//  Its handler (WideTimer4A_Handler in "osasm.s") reads the PC stacked on 
+//  exception entry and passes it to Profile_sample(), which counts it for
+//  the running task in a hash table. A dump of g_profile is symbolized on 
+//  the host against the ELF/AXF image (tools/profdecode).
+//
+//*****************************************************************************
+
+#ifndef __PROFILE_H__
+#define __PROFILE_H__
+
+#include "os_config.h"
+
+//*****************************************************************************
+//
+//  The following are defines for the profile buffer layout. The buffer is 
+//  dumped as raw memory and decoded on the host, so the layout must not 
+//  change without bumping PROFILE_VERSION.
+//
+//*****************************************************************************
+
+#define PROFILE_MAGIC 		0x464f5250	// "PROF" in little endian
+#define PROFILE_VERSION 	1
+#define PROFILE_MASK 		(OS_CFG_PROFILE_SIZE - 1)
+#define PROFILE_PROBES 		8			// slots tried before a drop
+
+//*****************************************************************************
+//
+//  This data structure defines a slot of the table (12 bytes). A slot 
+//  counts the samples of one PC within one task; hits is 0 if unused. On 
+//  the host port the PC is an offset from the start of the executable.
+//
+//*****************************************************************************
+
+struct profile_slot
+{
+	uint32_t pc;			// sampled program counter
+	uint16_t task;			// index of the task in the order it was added
+	uint16_t reserved;
+	uint32_t hits;			// number of samples
+};
+
+//*****************************************************************************
+//
+//  This data structure defines the profile buffer.
+//
+//*****************************************************************************
+
+struct profile_buffer
+{
+	uint32_t magic;			// PROFILE_MAGIC
+	uint16_t version;		// PROFILE_VERSION
+	uint16_t size;			// number of slots (power of two)
+	uint32_t freq;			// samples per second
+	uint32_t samples;		// samples taken
+	uint32_t dropped;		// samples lost (no free slot)
+	struct profile_slot slots[OS_CFG_PROFILE_SIZE];
+};
+
+//*****************************************************************************
+//
+//	Prototypes for the API
+//
+//*****************************************************************************
+
+#if OS_CFG_PROFILE
+extern struct profile_buffer g_profile;
+
+extern void Profile_init(void);
+extern void Profile_sample(uint32_t pc);
+#endif
+
+#endif	// __PROFILE_H__
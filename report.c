@@ -0,0 +1,155 @@
+//*****************************************************************************
+//
+//  Machine-readable reports of the kernel statistics.
+//  File: 		report.c
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//  Every report line is a list of key=value pairs, so results from the host
+//  port, QEMU and the board can be collected by the same scripts.
+//
+//*****************************************************************************
+//*****************************************************************************
+//
+//  The following are header files for the C standard library.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdio.h>
+
+//*****************************************************************************
+//
+//  This is the application header file.
+//
+//*****************************************************************************
+
+#include "os.h"
+#include "hist.h"
+#include "report.h"
+#include "console.h"
+
+//*****************************************************************************
+//
+//  Functions for the API.
+//
+//*****************************************************************************
+//*****************************************************************************
+//
+//! @brief Print the task statistics.
+//!
+//! This function writes one line per task to the console with its share of 
+//! the CPU (in hundredths of a percent, no floating point), preemptions and 
+//! yields.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Report_task_stats(void)
+{
+#if OS_CFG_TASK_STATS
+	struct os_task_stats stats[16];
+	uint64_t total = 0;
+	uint32_t share;
+	uint8_t i, cnt;
+	char line[96];
+
+	cnt = OS_get_task_stats(stats, 16);
+	for (i = 0; i < cnt; i++)
+	{
+		total += stats[i].cycles;
+	}
+
+	for (i = 0; i < cnt; i++)
+	{
+		share = total ? (uint32_t)((stats[i].cycles * 10000) / total) : 0;
+		snprintf(line, sizeof(line), "task=%u prio=%u cpu=%lu.%02lu%% "
+			"preemptions=%lu yields=%lu\n", i, stats[i].priority, 
+			(unsigned long)(share / 100), (unsigned long)(share % 100), 
+			(unsigned long)stats[i].preemptions, 
+			(unsigned long)stats[i].yields);
+		Console_write(line);
+	}
+#endif
+}
+
+//*****************************************************************************
+//
+//! @brief Print the summary of a histogram.
+//!
+//! This function writes one line with the number of values, the minimum, 
+//! mean, 50th, 90th, 99th and 99.9th percentiles and the maximum, e.g.
+//!
+//!   hist=wake count=5000 min=61 mean=96 p50=95 p90=111 p99=143 p999=319 
+//!       max=402
+//!
+//! @param[in] p_name Name of the histogram (a single word).
+//! @param[in] p_hist Pointer to the histogram.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Report_hist(const char *p_name, const struct hist *p_hist)
+{
+	uint32_t cnt = Hist_count(p_hist);
+	char line[160];
+
+	snprintf(line, sizeof(line), "hist=%s count=%lu min=%lu mean=%lu p50=%lu "
+		"p90=%lu p99=%lu p999=%lu max=%lu\n", p_name, (unsigned long)cnt, 
+		(unsigned long)(cnt ? p_hist->min : 0), 
+		(unsigned long)Hist_mean(p_hist), 
+		(unsigned long)Hist_percentile(p_hist, 5000), 
+		(unsigned long)Hist_percentile(p_hist, 9000), 
+		(unsigned long)Hist_percentile(p_hist, 9900), 
+		(unsigned long)Hist_percentile(p_hist, 9990), 
+		(unsigned long)p_hist->max);
+	Console_write(line);
+}
+
+//*****************************************************************************
+//
+//! @brief Print the kernel histograms (OS_CFG_HIST).
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Report_kernel_hist(void)
+{
+#if OS_CFG_HIST
+	Report_hist("sched", &g_hist_sched);
+	Report_hist("wake", &g_hist_wake);
+	Report_hist("isr", &g_hist_isr);
+#if OS_CFG_IRQ_OFF_TRACK
+	Report_hist("irqoff", &g_hist_irq_off);
+#endif
+#endif
+}
+
+//*****************************************************************************
+//
+//! @brief Print the longest time with interrupts disabled by the kernel 
+//! (OS_CFG_IRQ_OFF_TRACK).
+//!
+//! This function writes one line with the duration, the kernel function and
+//! line where the critical section began, and the number of sections, e.g.
+//!
+//!   irqoff max_cycles=212 func=OS_Semaphore_post line=679 count=48211
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Report_irq_off(void)
+{
+#if OS_CFG_IRQ_OFF_TRACK
+	struct os_irq_off irq_off;
+	char line[128];
+
+	OS_get_irq_off(&irq_off);
+	snprintf(line, sizeof(line), "irqoff max_cycles=%lu func=%s line=%u "
+		"count=%lu\n", (unsigned long)irq_off.max_cycles, 
+		irq_off.p_func ? irq_off.p_func : "none", irq_off.line, 
+		(unsigned long)irq_off.count);
+	Console_write(line);
+#endif
+}
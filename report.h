@@ -0,0 +1,27 @@
+//*****************************************************************************
+//
+//  Prototypes for the kernel reports.
+//  File: 		report.h
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//*****************************************************************************
+
+#ifndef __REPORT_H__
+#define __REPORT_H__
+
+//*****************************************************************************
+//
+//	Prototypes for the API
+//
+//*****************************************************************************
+
+extern void Report_task_stats(void);
+extern void Report_kernel_hist(void);
+extern void Report_irq_off(void);
+
+struct hist;
+extern void Report_hist(const char *p_name, const struct hist *p_hist);
+
+#endif	// __REPORT_H__
@@ -0,0 +1,186 @@
+//*****************************************************************************
+//
+//  Response-time analysis and EDF schedulability test.
+//  File: 		rta.c
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//*****************************************************************************
+//*****************************************************************************
+//
+//  The following are header files for the C standard library.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//*****************************************************************************
+//
+//  This is the application header file.
+//
+//*****************************************************************************
+
+#include "rta.h"
+
+//*****************************************************************************
+//
+//  Functions for the internal use.
+//
+//*****************************************************************************
+//*****************************************************************************
+//
+//! @brief Get the relative deadline of a task.
+//
+//*****************************************************************************
+static uint32_t deadline_of(const struct rta_task *p_task)
+{
+	return p_task->deadline ? p_task->deadline : p_task->period;
+}
+
+//*****************************************************************************
+//
+//! @brief Get the share of the CPU taken by a task.
+//!
+//! @param[in] wcet Execution time.
+//! @param[in] period Time over which it runs (period or deadline).
+//!
+//! @return wcet / period in units of 2^-32, rounded up.
+//
+//*****************************************************************************
+static uint64_t share_of(uint32_t wcet, uint32_t period)
+{
+	return (((uint64_t)wcet << 32) + period - 1) / period;
+}
+
+//*****************************************************************************
+//
+//  Functions for the API.
+//
+//*****************************************************************************
+//*****************************************************************************
+//
+//! @brief Get the worst-case response time of a task under fixed priority.
+//!
+//! This function iterates R = C + sum(ceil(R / Tj) * Cj) over the tasks of
+//! the same or a higher priority until it settles (Joseph and Pandya). A
+//! task of the same priority counts as higher, since the round robin may
+//! run it first. Release jitter, blocking and the kernel overhead are not
+//! included, so the WCETs should account for them.
+//!
+//! @param[in] p_set Array of tasks.
+//! @param[in] size Number of tasks.
+//! @param[in] idx Index of the task to analyse.
+//!
+//! @return Response time (us), RTA_UNSCHEDULABLE if past the deadline.
+//
+//*****************************************************************************
+uint32_t Rta_response_time(const struct rta_task *p_set, uint8_t size,
+	uint8_t idx)
+{
+	const struct rta_task *p_task = &p_set[idx];
+	uint64_t resp, prev;
+	uint8_t j;
+
+	resp = p_task->wcet;
+	do
+	{
+		prev = resp;
+		resp = p_task->wcet;
+		for (j = 0; j < size; j++)
+		{
+			if((j != idx) && (p_set[j].priority <= p_task->priority))
+			{
+				resp += ((prev + p_set[j].period - 1) / p_set[j].period) *
+					p_set[j].wcet;
+			}
+		}
+		if(resp > deadline_of(p_task))
+		{
+			return RTA_UNSCHEDULABLE;
+		}
+	} while(resp != prev);
+
+	return (uint32_t)resp;
+}
+
+//*****************************************************************************
+//
+//! @brief Check a task set under fixed priority.
+//!
+//! @param[in] p_set Array of tasks.
+//! @param[in] size Number of tasks.
+//!
+//! @return True if every task meets its deadline.
+//
+//*****************************************************************************
+bool Rta_fp_check(const struct rta_task *p_set, uint8_t size)
+{
+	uint8_t i;
+
+	for (i = 0; i < size; i++)
+	{
+		if(Rta_response_time(p_set, size, i) == RTA_UNSCHEDULABLE)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+//*****************************************************************************
+//
+//! @brief Check a task set under EDF.
+//!
+//! This function sums the density C / min(D, T) of the tasks, which must not
+//! exceed 1. With the deadlines equal to the periods (as for the periodic
+//! events) the test is exact (Liu and Layland), with shorter deadlines it is
+//! only sufficient. Each term is rounded up to 2^-32.
+//!
+//! @param[in] p_set Array of tasks.
+//! @param[in] size Number of tasks.
+//!
+//! @return True if every task meets its deadline.
+//
+//*****************************************************************************
+bool Rta_edf_check(const struct rta_task *p_set, uint8_t size)
+{
+	uint64_t density = 0;
+	uint32_t span;
+	uint8_t i;
+
+	for (i = 0; i < size; i++)
+	{
+		span = deadline_of(&p_set[i]);
+		if(span > p_set[i].period)
+		{
+			span = p_set[i].period;
+		}
+		density += share_of(p_set[i].wcet, span);
+	}
+	return density <= ((uint64_t)1 << 32);
+}
+
+//*****************************************************************************
+//
+//! @brief Get the CPU utilization of a task set.
+//!
+//! @param[in] p_set Array of tasks.
+//! @param[in] size Number of tasks.
+//!
+//! @return Sum of C / T in parts per million, rounded up.
+//
+//*****************************************************************************
+uint32_t Rta_utilization(const struct rta_task *p_set, uint8_t size)
+{
+	uint64_t ppm = 0;
+	uint8_t i;
+
+	for (i = 0; i < size; i++)
+	{
+		ppm += ((uint64_t)p_set[i].wcet * 1000000 + p_set[i].period - 1) /
+			p_set[i].period;
+	}
+	return ppm > UINT32_MAX ? UINT32_MAX : (uint32_t)ppm;
+}
@@ -0,0 +1,51 @@
+//*****************************************************************************
+//
+//  Prototypes and data structures for the schedulability analysis.
+//  File: 		rta.h
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//  The analysis runs over a set of periodic tasks, each one released every
+//  period and running for at most its worst-case execution time (WCET)
+//  before its relative deadline. It is shared by the kernel admission
+//  control (OS_add_periodic_event_wcet) and the host tool (tools/rtacheck),
+//  so it has no dependency on the port.
+//
+//*****************************************************************************
+
+#ifndef __RTA_H__
+#define __RTA_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//*****************************************************************************
+//
+//  This data structure defines a periodic task. All the times are in us.
+//
+//*****************************************************************************
+
+struct rta_task
+{
+	uint32_t period;		// time between releases
+	uint32_t wcet;			// worst-case execution time of a job
+	uint32_t deadline;		// relative to the release, 0 for the period
+	uint8_t priority;		// 0 is highest (fixed priority only)
+};
+
+#define RTA_UNSCHEDULABLE 	UINT32_MAX	// response time past the deadline
+
+//*****************************************************************************
+//
+//	Prototypes for the API
+//
+//*****************************************************************************
+
+extern uint32_t Rta_response_time(const struct rta_task *p_set, uint8_t size,
+	uint8_t idx);
+extern bool Rta_fp_check(const struct rta_task *p_set, uint8_t size);
+extern bool Rta_edf_check(const struct rta_task *p_set, uint8_t size);
+extern uint32_t Rta_utilization(const struct rta_task *p_set, uint8_t size);
+
+#endif	// __RTA_H__
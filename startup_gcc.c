@@ -0,0 +1,237 @@
+//*****************************************************************************
+//  startup_gcc.c - Vector table and reset handler for arm-none-eabi-gcc
+//  Runs on TM4C123
+//  Ronald Rodriguez Ruiz
+//  October 18, 2026
+//
+//  The Keil project uses the startup file of the device pack. This file is
+//  its counterpart for the GNU Arm build (CMake, RTOS_PORT=tm4c123), linked
+//  with tm4c123gh6pm.ld.
+//*****************************************************************************
+
+#include <stdint.h>
+
+//*****************************************************************************
+//
+//  The following are symbols defined by the linker script (tm4c123gh6pm.ld).
+//
+//*****************************************************************************
+
+extern uint32_t __data_load__, __data_start__, __data_end__;
+extern uint32_t __bss_start__, __bss_end__;
+extern uint32_t __stack_top__;
+
+//*****************************************************************************
+//
+//  Prototypes for the handlers.
+//
+//*****************************************************************************
+
+extern int main(void);
+extern void SysTick_Handler(void);      // "osasm_gcc.S"
+extern void WideTimer5A_Handler(void);  // "os.c"
+extern void Timer1A_Handler(void);      // "swi.c"
+extern void WideTimer4A_Handler(void);  // "osasm_gcc.S"
+extern void WideTimer3A_Handler(void);  // "os.c"
+void Reset_Handler(void);
+static void Default_Handler(void);
+
+//*****************************************************************************
+//
+//  The vector table. Unused interrupts trap in Default_Handler.
+//
+//*****************************************************************************
+
+__attribute__((section(".vectors"), used))
+void (* const g_vectors[])(void) =
+{
+    (void (*)(void))&__stack_top__,     // initial stack pointer
+    Reset_Handler,                      // reset handler
+    Default_Handler,                    // NMI
+    Default_Handler,                    // hard fault
+    Default_Handler,                    // MPU fault
+    Default_Handler,                    // bus fault
+    Default_Handler,                    // usage fault
+    0, 0, 0, 0,                         // reserved
+    Default_Handler,                    // SVCall
+    Default_Handler,                    // debug monitor
+    0,                                  // reserved
+    Default_Handler,                    // PendSV
+    SysTick_Handler,                    // SysTick (context switch)
+    Default_Handler,                    // 0: GPIO Port A
+    Default_Handler,                    // 1: GPIO Port B
+    Default_Handler,                    // 2: GPIO Port C
+    Default_Handler,                    // 3: GPIO Port D
+    Default_Handler,                    // 4: GPIO Port E
+    Default_Handler,                    // 5: UART0
+    Default_Handler,                    // 6: UART1
+    Default_Handler,                    // 7: SSI0
+    Default_Handler,                    // 8: I2C0
+    Default_Handler,                    // 9: PWM0 Fault
+    Default_Handler,                    // 10: PWM0 Generator 0
+    Default_Handler,                    // 11: PWM0 Generator 1
+    Default_Handler,                    // 12: PWM0 Generator 2
+    Default_Handler,                    // 13: QEI0
+    Default_Handler,                    // 14: ADC0 Sequence 0
+    Default_Handler,                    // 15: ADC0 Sequence 1
+    Default_Handler,                    // 16: ADC0 Sequence 2
+    Default_Handler,                    // 17: ADC0 Sequence 3
+    Default_Handler,                    // 18: Watchdog Timers 0 and 1
+    Default_Handler,                    // 19: 16/32-Bit Timer 0A
+    Default_Handler,                    // 20: 16/32-Bit Timer 0B
+    Timer1A_Handler,                    // 21: 16/32-Bit Timer 1A (software interrupt)
+    Default_Handler,                    // 22: 16/32-Bit Timer 1B
+    Default_Handler,                    // 23: 16/32-Bit Timer 2A
+    Default_Handler,                    // 24: 16/32-Bit Timer 2B
+    Default_Handler,                    // 25: Analog Comparator 0
+    Default_Handler,                    // 26: Analog Comparator 1
+    0,                                  // 27: reserved
+    Default_Handler,                    // 28: System Control
+    Default_Handler,                    // 29: Flash Memory Control and EEPROM
+    Default_Handler,                    // 30: GPIO Port F
+    0,                                  // 31: reserved
+    0,                                  // 32: reserved
+    Default_Handler,                    // 33: UART2
+    Default_Handler,                    // 34: SSI1
+    Default_Handler,                    // 35: Timer 3A
+    Default_Handler,                    // 36: Timer 3B
+    Default_Handler,                    // 37: I2C1
+    Default_Handler,                    // 38: QEI1
+    Default_Handler,                    // 39: CAN0
+    Default_Handler,                    // 40: CAN1
+    0,                                  // 41: reserved
+    0,                                  // 42: reserved
+    Default_Handler,                    // 43: Hibernation Module
+    Default_Handler,                    // 44: USB
+    Default_Handler,                    // 45: PWM Generator 3
+    Default_Handler,                    // 46: uDMA Software
+    Default_Handler,                    // 47: uDMA Error
+    Default_Handler,                    // 48: ADC1 Sequence 0
+    Default_Handler,                    // 49: ADC1 Sequence 1
+    Default_Handler,                    // 50: ADC1 Sequence 2
+    Default_Handler,                    // 51: ADC1 Sequence 3
+    0,                                  // 52: reserved
+    0,                                  // 53: reserved
+    0,                                  // 54: reserved
+    0,                                  // 55: reserved
+    0,                                  // 56: reserved
+    Default_Handler,                    // 57: SSI2
+    Default_Handler,                    // 58: SSI3
+    Default_Handler,                    // 59: UART3
+    Default_Handler,                    // 60: UART4
+    Default_Handler,                    // 61: UART5
+    Default_Handler,                    // 62: UART6
+    Default_Handler,                    // 63: UART7
+    0,                                  // 64: reserved
+    0,                                  // 65: reserved
+    0,                                  // 66: reserved
+    0,                                  // 67: reserved
+    Default_Handler,                    // 68: I2C2
+    Default_Handler,                    // 69: I2C3
+    Default_Handler,                    // 70: 16/32-Bit Timer 4A
+    Default_Handler,                    // 71: 16/32-Bit Timer 4B
+    0,                                  // 72: reserved
+    0,                                  // 73: reserved
+    0,                                  // 74: reserved
+    0,                                  // 75: reserved
+    0,                                  // 76: reserved
+    0,                                  // 77: reserved
+    0,                                  // 78: reserved
+    0,                                  // 79: reserved
+    0,                                  // 80: reserved
+    0,                                  // 81: reserved
+    0,                                  // 82: reserved
+    0,                                  // 83: reserved
+    0,                                  // 84: reserved
+    0,                                  // 85: reserved
+    0,                                  // 86: reserved
+    0,                                  // 87: reserved
+    0,                                  // 88: reserved
+    0,                                  // 89: reserved
+    0,                                  // 90: reserved
+    0,                                  // 91: reserved
+    Default_Handler,                    // 92: 16/32-Bit Timer 5A
+    Default_Handler,                    // 93: 16/32-Bit Timer 5B
+    Default_Handler,                    // 94: 32/64-Bit Timer 0A
+    Default_Handler,                    // 95: 32/64-Bit Timer 0B
+    Default_Handler,                    // 96: 32/64-Bit Timer 1A
+    Default_Handler,                    // 97: 32/64-Bit Timer 1B
+    Default_Handler,                    // 98: 32/64-Bit Timer 2A
+    Default_Handler,                    // 99: 32/64-Bit Timer 2B
+    WideTimer3A_Handler,                // 100: 32/64-Bit Timer 3A (sleeps)
+    Default_Handler,                    // 101: 32/64-Bit Timer 3B
+    WideTimer4A_Handler,                // 102: 32/64-Bit Timer 4A (profiler)
+    Default_Handler,                    // 103: 32/64-Bit Timer 4B
+    WideTimer5A_Handler,                // 104: 32/64-Bit Timer 5A (kernel events)
+    Default_Handler,                    // 105: 32/64-Bit Timer 5B
+    Default_Handler,                    // 106: System Exception (imprecise)
+    0,                                  // 107: reserved
+    0,                                  // 108: reserved
+    0,                                  // 109: reserved
+    0,                                  // 110: reserved
+    0,                                  // 111: reserved
+    0,                                  // 112: reserved
+    0,                                  // 113: reserved
+    0,                                  // 114: reserved
+    0,                                  // 115: reserved
+    0,                                  // 116: reserved
+    0,                                  // 117: reserved
+    0,                                  // 118: reserved
+    0,                                  // 119: reserved
+    0,                                  // 120: reserved
+    0,                                  // 121: reserved
+    0,                                  // 122: reserved
+    0,                                  // 123: reserved
+    0,                                  // 124: reserved
+    0,                                  // 125: reserved
+    0,                                  // 126: reserved
+    0,                                  // 127: reserved
+    0,                                  // 128: reserved
+    0,                                  // 129: reserved
+    0,                                  // 130: reserved
+    0,                                  // 131: reserved
+    0,                                  // 132: reserved
+    0,                                  // 133: reserved
+    Default_Handler,                    // 134: PWM1 Generator 0
+    Default_Handler,                    // 135: PWM1 Generator 1
+    Default_Handler,                    // 136: PWM1 Generator 2
+    Default_Handler,                    // 137: PWM1 Generator 3
+    Default_Handler,                    // 138: PWM1 Fault
+};
+
+//*****************************************************************************
+//
+//! @brief Reset handler.
+//!
+//! This function copies the initialized data from flash, clears the zero
+//! initialized data (task stacks included) and calls main(). The clock is
+//! set up by OS_start() (PLL_init), so there is no SystemInit() call.
+//
+//*****************************************************************************
+void Reset_Handler(void)
+{
+    uint32_t *p_src = &__data_load__;
+    uint32_t *p_dst = &__data_start__;
+
+    while(p_dst < &__data_end__)
+    {
+        *p_dst++ = *p_src++;
+    }
+    for (p_dst = &__bss_start__; p_dst < &__bss_end__; p_dst++)
+    {
+        *p_dst = 0;
+    }
+
+    main();
+    while(1);
+}
+
+//*****************************************************************************
+//
+//! @brief Handler of the unexpected exceptions (stops for the debugger).
+//
+//*****************************************************************************
+static void Default_Handler(void)
+{
+    while(1);
+}
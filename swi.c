@@ -0,0 +1,121 @@
+//*****************************************************************************
+//  swi.c - Software functions for the Software Interrupt
+//  Runs on LM4F120/TM4C123
+//  Ronald Rodriguez Ruiz
+//  October 18, 2026
+//
+//  The software interrupt borrows the vector of the Timer1A (IRQ 21), which
+//  is otherwise unused, and is raised through the NVIC software trigger
+//  register. It lets the benchmarks run an ISR on demand from a task. The 
+//  Timer1A itself can also raise it periodically, as an event source that 
+//  is asynchronous to the kernel tick.
+//*****************************************************************************
+
+#include <stdint.h>
+#include "swi.h"
+#include "tm4c123gh6pm.h"
+
+#define SWI_IRQ                 21          // Timer1A
+
+static void (*gp_handler)(void);            // called by Timer1A_Handler
+
+//*****************************************************************************
+//
+//! @brief Initialize the software interrupt.
+//!
+//! This function sets the handler and enables the IRQ with the given 
+//! priority level. The timer itself stays disabled.
+//!
+//! @param[in] p_handler Interrupt handler.
+//! @param[in] priority Interrupt priority level (from 0-7).
+//!
+//! @return None.
+//
+//*****************************************************************************
+void SWI_init(void (*p_handler)(void), uint8_t priority)
+{
+    gp_handler = p_handler;
+    //
+    //  Set interrupt priority
+    //
+    NVIC_PRI5_R = (NVIC_PRI5_R & ~NVIC_PRI5_INT21_M) | 
+        (priority << NVIC_PRI5_INT21_S);
+    //
+    //  Enable irq in NVIC
+    //
+    NVIC_EN0_R = 1 << SWI_IRQ;
+}
+
+//*****************************************************************************
+//
+//! @brief Raise the software interrupt.
+//!
+//! When called from a task, the handler runs before this function returns.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void SWI_trigger(void)
+{
+    NVIC_SW_TRIG_R = SWI_IRQ;
+}
+
+//*****************************************************************************
+//
+//! @brief Raise the software interrupt periodically.
+//!
+//! This function configures the Timer1A to overflow based on the period 
+//! passed. SWI_init() must have been called before.
+//!
+//! @param[in] period Overflow period (core clock cycles).
+//!
+//! @return None.
+//
+//*****************************************************************************
+void SWI_start_timer(uint32_t period)
+{
+    volatile uint32_t delay;
+
+    //
+    //  Enable timer1 clock gating (legacy register, also on the LM3S)
+    //
+    SYSCTL_RCGC1_R |= SYSCTL_RCGC1_TIMER1;
+    //
+    //  Delay to allow clock to stabilize
+    //
+    delay = SYSCTL_RCGC1_R;
+    (void)delay;
+    //
+    //  Disable timer1A during setup
+    //
+    TIMER1_CTL_R &= ~TIMER_CTL_TAEN;
+    //
+    //  Set timer to 32-bit, periodic and count down mode
+    //
+    TIMER1_CFG_R = TIMER_CFG_32_BIT_TIMER;
+    TIMER1_TAMR_R = TIMER_TAMR_TAMR_PERIOD;
+    //
+    //  Set reload value
+    //
+    TIMER1_TAILR_R = period - 1;
+    //
+    //  Clear interrupt flag and arm interrupt
+    //
+    TIMER1_ICR_R = TIMER_ICR_TATOCINT;
+    TIMER1_IMR_R |= TIMER_IMR_TATOIM;
+    //
+    //  Enable timer1A
+    //
+    TIMER1_CTL_R |= TIMER_CTL_TAEN;
+}
+
+//*****************************************************************************
+//
+//! @brief IRQ Handler for the timer 1A (software interrupt).
+//
+//*****************************************************************************
+void Timer1A_Handler(void)
+{
+    TIMER1_ICR_R = TIMER_ICR_TATOCINT;
+    gp_handler();
+}
@@ -0,0 +1,21 @@
+//*****************************************************************************
+//  swi.h - Prototypes for the Software Interrupt
+//  Runs on LM4F120/TM4C123
+//  Ronald Rodriguez Ruiz
+//  October 18, 2026
+//*****************************************************************************
+
+#ifndef __SWI_H__
+#define __SWI_H__
+
+//*****************************************************************************
+//
+//  Prototypes for the API
+//
+//*****************************************************************************
+
+extern void SWI_init(void (*p_handler)(void), uint8_t priority);
+extern void SWI_trigger(void);
+extern void SWI_start_timer(uint32_t period);
+
+#endif  // __SWI_H__
@@ -8,8 +8,21 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "systick.h"
+#include "dwt.h"
 #include "tm4c123gh6pm.h"
 
+//*****************************************************************************
+//
+//  PORT_SYSTICK_CYCLES is set by the ports that count the cycles with the
+//  SysTick (port/lm3s6965/dwt.c). The counter is then never written once it
+//  runs, so the count only goes forward.
+//
+//*****************************************************************************
+
+#ifndef PORT_SYSTICK_CYCLES
+#define PORT_SYSTICK_CYCLES 	0
+#endif
+
 //*****************************************************************************
 //
 //! @brief Initialize the System Timer (SysTick).
@@ -22,11 +35,26 @@
 //! @param[in] irq_enabled Flag to enable the SysTick interrupt.
 //! @param[in] priority Interrupt priority level (from 0-7).
 //!
+//! With PORT_SYSTICK_CYCLES a running SysTick keeps counting, and the new 
+//! period starts when the one in progress ends.
+//!
 //! @return None.
 //
 //*****************************************************************************
 void SysTick_init(uint32_t period, bool irq_enabled, uint8_t priority)
 {
+#if PORT_SYSTICK_CYCLES
+	if (NVIC_ST_CTRL_R & NVIC_ST_CTRL_ENABLE)
+	{
+		//
+		//	Count the period in progress with its reload value first
+		//
+		(void)DWT_get_cycles();
+		NVIC_ST_RELOAD_R = period - 1;
+		return;
+	}
+#endif
+
 	//
 	//	Disable SysTick during setup
 	//
@@ -64,6 +92,41 @@ void SysTick_init(uint32_t period, bool irq_enabled, uint8_t priority)
 	}
 }
 
+//*****************************************************************************
+//
+//! @brief Initialize the SysTick interrupt as a software interrupt.
+//!
+//! This function sets the priority level of the SysTick interrupt, which 
+//! then only runs when SysTick_set_pending() is called. The counter keeps 
+//! running over its full range without raising the interrupt, as a time 
+//! base for the ports without a cycle counter (QEMU, port/lm3s6965/dwt.c).
+//!
+//! @param[in] priority Interrupt priority level (from 0-7).
+//!
+//! @return None.
+//
+//*****************************************************************************
+void SysTick_init_soft(uint8_t priority)
+{
+	//
+	//	Disable SysTick counter and interrupt during setup
+	//
+	NVIC_ST_CTRL_R &= ~(NVIC_ST_CTRL_ENABLE | NVIC_ST_CTRL_INTEN);
+
+	//
+	//	Free running counter with the core clock, without interrupt
+	//
+	NVIC_ST_RELOAD_R = NVIC_ST_RELOAD_M;
+	NVIC_ST_CURRENT_R = 0;
+	NVIC_ST_CTRL_R |= NVIC_ST_CTRL_CLK_SRC | NVIC_ST_CTRL_ENABLE;
+
+	//
+	//	Interrupt priority 
+	//
+	NVIC_SYS_PRI3_R = (NVIC_SYS_PRI3_R & ~NVIC_SYS_PRI3_TICK_M) | 
+		(NVIC_SYS_PRI3_TICK_M & (priority << NVIC_SYS_PRI3_TICK_S));
+}
+
 //*****************************************************************************
 //
 //! @brief Wait the Systick count flag.
@@ -140,17 +203,21 @@ void SysTick_delay_us(uint32_t us)
 //! @brief Trigger the SysTick interrupt.
 //!
 //! This function sets the pending flag of the SysTick interrupt on the 
-//! Interrupt Control Register to execute the SysTick_Handler.
+//! Interrupt Control Register to execute the SysTick_Handler. The counter 
+//! is reset, so that the next task starts with a full tick (not with 
+//! PORT_SYSTICK_CYCLES).
 //!
 //! @return None.
 //
 //*****************************************************************************
 void SysTick_set_pending(void)
 {
+#if !PORT_SYSTICK_CYCLES
 	//
 	//	Reset the counter
 	//
 	NVIC_ST_CURRENT_R = 0;
+#endif
 	
 	//
 	//	Change the SysTick exception state to pending
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 extern void SysTick_init(uint32_t period, bool irq_enabled, uint8_t priority);
+extern void SysTick_init_soft(uint8_t priority);
 extern void SysTick_wait(void);
 extern void SysTick_delay_ms(uint32_t ms);
 extern void SysTick_delay_us(uint32_t us);
@@ -90,3 +90,209 @@ void Timer_WTimer5A_clear_irq(void)
 {
   WTIMER5_ICR_R = TIMER_ICR_TATOCINT;
 }
+
+//*****************************************************************************
+//
+//! @brief Read the counter of the Wide Timer5A.
+//!
+//! @return Current value (counts down from the period - 1 to 0).
+//
+//*****************************************************************************
+uint32_t Timer_WTimer5A_get_count(void)
+{
+    return WTIMER5_TAR_R;
+}
+
+//*****************************************************************************
+//
+//! @brief Check if the Wide Timer5A has timed out.
+//!
+//! @return Nonzero if the counter reloaded since the flag was last cleared.
+//
+//*****************************************************************************
+uint32_t Timer_WTimer5A_expired(void)
+{
+    return WTIMER5_RIS_R & TIMER_RIS_TATORIS;
+}
+
+//*****************************************************************************
+//
+//! @brief Change the period of the Wide Timer5A.
+//!
+//! The counter is loaded with the new period on the next cycle (TAILD is 
+//! clear), so the count since the last timeout is dropped. The caller
+//! reads it first (Timer_WTimer5A_get_count) if it keeps the time.
+//!
+//! @param[in] period Overflow period.
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Timer_WTimer5A_set_period(uint32_t period)
+{
+    WTIMER5_TAILR_R = period - 1;
+}
+
+//*****************************************************************************
+//
+//! @brief Initialize the Wide Timer4A.
+//!
+//! This function configures the Wide Timer4A to overflow based on the period 
+//! passed and enables its IRQ with the given priority level. It drives the
+//! PC-sampling profiler (profile.c).
+//!
+//! @param[in] period Overflow period.
+//! @param[in] priority Interrupt priority level (from 0-7).
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Timer_WTimer4A_init(uint32_t period, uint8_t priority)
+{
+    //
+    //  Enable wide timer4 clock gating
+    //
+    SYSCTL_RCGCWTIMER_R |= SYSCTL_RCGCWTIMER_R4;
+    //
+    //  Delay to allow clock to stabilize
+    // 
+    while((SYSCTL_PRWTIMER_R & SYSCTL_PRWTIMER_R4) == 0){};
+    //
+    //  Disable wide timer4A during setup
+    //
+    WTIMER4_CTL_R &= ~TIMER_CTL_TAEN;
+    //
+    //  Set timer to 32-bit and count down mode
+    // 
+    WTIMER4_CFG_R = TIMER_CFG_16_BIT; 
+    //
+    //  Set timer to periodic mode
+    //
+    WTIMER4_TAMR_R = TIMER_TAMR_TAMR_PERIOD;
+    //
+    //  Set reload value
+    //
+    WTIMER4_TAILR_R = period - 1;
+    //
+    //  No prescaler
+    //
+    WTIMER4_TAPR_R = 0;
+    //
+    //  Clear interrupt flag
+    //            
+    WTIMER4_ICR_R = TIMER_ICR_TATOCINT;
+    // 
+    //  Arm interrupt
+    //
+    WTIMER4_IMR_R |= TIMER_IMR_TATOIM;
+    //
+    //  Set interrupt priority
+    // 
+    NVIC_PRI25_R = (NVIC_PRI25_R & ~NVIC_PRI25_INTC_M) | 
+        (NVIC_PRI25_INTC_M & (priority << NVIC_PRI25_INTC_S)); 
+    //
+    //  Enable irq 102 in NVIC
+    // 
+    NVIC_EN3_R |= NVIC_EN3_INT_M & (1 << 6);               
+    //
+    //  Enable wide timer4A 
+    //
+    WTIMER4_CTL_R |= TIMER_CTL_TAEN; 
+}
+
+//*****************************************************************************
+//
+//! @brief Clear the Wide Timer4A interrupt flag.
+//
+//*****************************************************************************
+void Timer_WTimer4A_clear_irq(void)
+{
+    WTIMER4_ICR_R = TIMER_ICR_TATOCINT;
+}
+
+//*****************************************************************************
+//
+//! @brief Initialize the Wide Timer3A.
+//!
+//! This function configures the Wide Timer3A as a one-shot and enables its 
+//! IRQ with the given priority level. The timer is started with 
+//! Timer_WTimer3A_start(). It drives the high-resolution sleeps ("os.c").
+//!
+//! @param[in] priority Interrupt priority level (from 0-7).
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Timer_WTimer3A_init(uint8_t priority)
+{
+    //
+    //  Enable wide timer3 clock gating
+    //
+    SYSCTL_RCGCWTIMER_R |= SYSCTL_RCGCWTIMER_R3;
+    //
+    //  Delay to allow clock to stabilize
+    // 
+    while((SYSCTL_PRWTIMER_R & SYSCTL_PRWTIMER_R3) == 0){};
+    //
+    //  Disable wide timer3A during setup
+    //
+    WTIMER3_CTL_R &= ~TIMER_CTL_TAEN;
+    //
+    //  Set timer to 32-bit and count down mode
+    // 
+    WTIMER3_CFG_R = TIMER_CFG_16_BIT; 
+    //
+    //  Set timer to one-shot mode
+    //
+    WTIMER3_TAMR_R = TIMER_TAMR_TAMR_1_SHOT;
+    //
+    //  No prescaler
+    //
+    WTIMER3_TAPR_R = 0;
+    //
+    //  Clear interrupt flag
+    //            
+    WTIMER3_ICR_R = TIMER_ICR_TATOCINT;
+    // 
+    //  Arm interrupt
+    //
+    WTIMER3_IMR_R |= TIMER_IMR_TATOIM;
+    //
+    //  Set interrupt priority
+    // 
+    NVIC_PRI25_R = (NVIC_PRI25_R & ~NVIC_PRI25_INTA_M) | 
+        (NVIC_PRI25_INTA_M & (priority << NVIC_PRI25_INTA_S)); 
+    //
+    //  Enable irq 100 in NVIC
+    // 
+    NVIC_EN3_R |= NVIC_EN3_INT_M & (1 << 4);               
+}
+
+//*****************************************************************************
+//
+//! @brief Start the Wide Timer3A one-shot.
+//!
+//! This function (re)starts the count, cancelling the previous one if it has
+//! not timed out yet.
+//!
+//! @param[in] period Time to the interrupt (core clock cycles, nonzero).
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Timer_WTimer3A_start(uint32_t period)
+{
+    WTIMER3_CTL_R &= ~TIMER_CTL_TAEN;
+    WTIMER3_TAILR_R = period - 1;
+    WTIMER3_CTL_R |= TIMER_CTL_TAEN; 
+}
+
+//*****************************************************************************
+//
+//! @brief Clear the Wide Timer3A interrupt flag.
+//
+//*****************************************************************************
+void Timer_WTimer3A_clear_irq(void)
+{
+    WTIMER3_ICR_R = TIMER_ICR_TATOCINT;
+}
@@ -16,5 +16,13 @@
 
 void Timer_WTimer5A_init(uint32_t period, uint8_t priority);
 void Timer_WTimer5A_clear_irq(void);
+uint32_t Timer_WTimer5A_get_count(void);
+uint32_t Timer_WTimer5A_expired(void);
+void Timer_WTimer5A_set_period(uint32_t period);
+void Timer_WTimer4A_init(uint32_t period, uint8_t priority);
+void Timer_WTimer4A_clear_irq(void);
+void Timer_WTimer3A_init(uint8_t priority);
+void Timer_WTimer3A_start(uint32_t period);
+void Timer_WTimer3A_clear_irq(void);
 
 #endif  // __TIMER_H__
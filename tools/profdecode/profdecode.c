@@ -0,0 +1,568 @@
+//*****************************************************************************
+//
+//  Host-side symbolizer for the kernel profile buffer.
+//  File: 		profdecode.c
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//  Reads a raw memory dump of g_profile (see profile.h), maps every sampled
+//  PC to a function of the image (ELF/AXF symbol table) and prints the hot
+//  spots of every task and of the whole system on stdout.
+//
+//  Usage: profdecode [-t name0,name1,...] [-n top] image.elf dump
+//
+//*****************************************************************************
+//*****************************************************************************
+//
+//  The following are header files for the C standard library.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <elf.h>
+
+//*****************************************************************************
+//
+//  This is the kernel header file with the buffer layout.
+//
+//*****************************************************************************
+
+#include "profile.h"
+
+//*****************************************************************************
+//
+//  The following are defines for the decoder.
+//
+//*****************************************************************************
+
+#define MAX_TASKS 			256			// task ids are 8 bits
+#define NAME_SIZE 			32
+#define HEADER_SIZE 		20			// bytes before the first slot
+#define SLOT_SIZE 			12			// bytes per slot
+#define TASK_ALL 			MAX_TASKS	// row of the whole system
+
+//*****************************************************************************
+//
+//  This data structure defines a function of the image.
+//
+//*****************************************************************************
+
+struct symbol
+{
+	uint64_t addr;
+	uint64_t size;			// if 0 in the image, set to the next symbol or
+							// the end of its section
+	uint64_t section_end;	// end of its section (0 if none)
+	const char *p_name;
+};
+
+//*****************************************************************************
+//
+//  This data structure defines the samples of a function (or of an unknown
+//  PC) within a task.
+//
+//*****************************************************************************
+
+struct hot
+{
+	uint32_t task;			// task id or TASK_ALL
+	const char *p_name;
+	uint32_t pc;			// for the unknown PCs
+	uint32_t hits;
+};
+
+//*****************************************************************************
+//
+//  The following are global definitions for the decoder.
+//
+//*****************************************************************************
+
+static char g_names[MAX_TASKS][NAME_SIZE];
+static uint8_t *gp_image;
+static struct symbol *gp_symbols;
+static uint32_t g_symbol_cnt;
+static uint64_t g_pc_base;
+static uint64_t g_text_start;	// code of the image (executable sections)
+static uint64_t g_text_end;
+static const char g_outside[] = "[outside image]";
+static struct hot *gp_hots;
+static uint32_t g_hot_cnt;
+
+//*****************************************************************************
+//
+//  Private Functions.
+//
+//*****************************************************************************
+//*****************************************************************************
+//
+//! @brief Read little endian values from the dump.
+//
+//*****************************************************************************
+static uint32_t read_u32(const uint8_t *p)
+{
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+		((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t read_u16(const uint8_t *p)
+{
+	return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+//*****************************************************************************
+//
+//! @brief Read a whole file into memory.
+//
+//*****************************************************************************
+static uint8_t *read_file(const char *p_path, long *p_size)
+{
+	FILE *p_file;
+	uint8_t *p_data;
+
+	p_file = fopen(p_path, "rb");
+	if(p_file == NULL)
+	{
+		perror(p_path);
+		return NULL;
+	}
+	fseek(p_file, 0, SEEK_END);
+	*p_size = ftell(p_file);
+	fseek(p_file, 0, SEEK_SET);
+
+	p_data = malloc(*p_size > 0 ? *p_size : 1);
+	if(p_data == NULL || fread(p_data, 1, *p_size, p_file) !=
+		(size_t)*p_size)
+	{
+		fprintf(stderr, "%s: read error\n", p_path);
+		free(p_data);
+		p_data = NULL;
+	}
+	fclose(p_file);
+	return p_data;
+}
+
+//*****************************************************************************
+//
+//! @brief Sort the symbols by address.
+//
+//*****************************************************************************
+static int compare_symbols(const void *p_a, const void *p_b)
+{
+	const struct symbol *p_sa = p_a, *p_sb = p_b;
+
+	return (p_sa->addr > p_sb->addr) - (p_sa->addr < p_sb->addr);
+}
+
+//*****************************************************************************
+//
+//! @brief Add a symbol of the image symbol table.
+//!
+//! Functions are kept (Thumb bit cleared). The start of the executable is
+//! the base of the PCs sampled by the host port.
+//!
+//! @param[in] section_end End address of the section of the symbol, 0 if
+//!            it has none.
+//
+//*****************************************************************************
+static void add_symbol(uint16_t machine, const char *p_name, uint8_t type,
+	uint64_t value, uint64_t size, uint64_t section_end)
+{
+	if(machine != EM_ARM && strcmp(p_name, "__executable_start") == 0)
+	{
+		g_pc_base = value;
+	}
+	if(type != STT_FUNC || p_name[0] == '\0')
+	{
+		return;
+	}
+	gp_symbols[g_symbol_cnt].addr = machine == EM_ARM ? value & ~1ull : value;
+	gp_symbols[g_symbol_cnt].size = size;
+	gp_symbols[g_symbol_cnt].section_end = section_end;
+	gp_symbols[g_symbol_cnt].p_name = p_name;
+	g_symbol_cnt++;
+}
+
+//*****************************************************************************
+//
+//! @brief Load the function symbols of an ELF32 or ELF64 image.
+//
+//*****************************************************************************
+static bool load_image(const char *p_path)
+{
+	long size;
+	uint32_t i, j, cnt;
+	uint16_t machine;
+	uint64_t end;
+
+	gp_image = read_file(p_path, &size);
+	if(gp_image == NULL)
+	{
+		return false;
+	}
+	if(size < EI_NIDENT || memcmp(gp_image, ELFMAG, SELFMAG) != 0 ||
+		gp_image[EI_DATA] != ELFDATA2LSB)
+	{
+		fprintf(stderr, "%s: not a little endian ELF image\n", p_path);
+		return false;
+	}
+
+#define LOAD_SYMBOLS(Ehdr, Shdr, Sym, ST_TYPE) 								\
+	do 																		\
+	{ 																		\
+		const Ehdr *p_eh = (const Ehdr *)gp_image; 							\
+		const Shdr *p_sh = (const Shdr *)(gp_image + p_eh->e_shoff); 		\
+		machine = p_eh->e_machine; 											\
+		for (i = 0; i < p_eh->e_shnum; i++) 								\
+		{ 																	\
+			if((p_sh[i].sh_flags & (SHF_ALLOC | SHF_EXECINSTR)) != 			\
+				(SHF_ALLOC | SHF_EXECINSTR) || p_sh[i].sh_size == 0) 		\
+			{ 																\
+				continue; 													\
+			} 																\
+			if(g_text_end == 0 || p_sh[i].sh_addr < g_text_start) 			\
+			{ 																\
+				g_text_start = p_sh[i].sh_addr; 							\
+			} 																\
+			if(p_sh[i].sh_addr + p_sh[i].sh_size > g_text_end) 				\
+			{ 																\
+				g_text_end = p_sh[i].sh_addr + p_sh[i].sh_size; 			\
+			} 																\
+		} 																	\
+		for (i = 0; i < p_eh->e_shnum; i++) 								\
+		{ 																	\
+			const Sym *p_sym; 												\
+			const char *p_str; 												\
+			uint32_t shndx; 												\
+			if(p_sh[i].sh_type != SHT_SYMTAB) 								\
+			{ 																\
+				continue; 													\
+			} 																\
+			p_sym = (const Sym *)(gp_image + p_sh[i].sh_offset); 			\
+			p_str = (const char *)gp_image + 								\
+				p_sh[p_sh[i].sh_link].sh_offset; 							\
+			cnt = p_sh[i].sh_size / sizeof(Sym); 							\
+			gp_symbols = calloc(cnt, sizeof(*gp_symbols)); 					\
+			for (j = 0; j < cnt; j++) 										\
+			{ 																\
+				shndx = p_sym[j].st_shndx; 									\
+				add_symbol(machine, p_str + p_sym[j].st_name, 				\
+					ST_TYPE(p_sym[j].st_info), p_sym[j].st_value, 			\
+					p_sym[j].st_size, (shndx != SHN_UNDEF && 				\
+					shndx < p_eh->e_shnum) ? p_sh[shndx].sh_addr + 			\
+					p_sh[shndx].sh_size : 0); 								\
+			} 																\
+			break; 															\
+		} 																	\
+	} while(0)
+
+	if(gp_image[EI_CLASS] == ELFCLASS32)
+	{
+		LOAD_SYMBOLS(Elf32_Ehdr, Elf32_Shdr, Elf32_Sym, ELF32_ST_TYPE);
+	}
+	else
+	{
+		LOAD_SYMBOLS(Elf64_Ehdr, Elf64_Shdr, Elf64_Sym, ELF64_ST_TYPE);
+	}
+#undef LOAD_SYMBOLS
+
+	if(g_symbol_cnt == 0)
+	{
+		fprintf(stderr, "%s: no function symbols (stripped?)\n", p_path);
+		return false;
+	}
+	qsort(gp_symbols, g_symbol_cnt, sizeof(*gp_symbols), compare_symbols);
+
+	// a symbol without a size (e.g. _fini) ends at the next symbol or at the
+	// end of its section, instead of taking every address above it
+	for (i = 0; i < g_symbol_cnt; i++)
+	{
+		if(gp_symbols[i].size)
+		{
+			continue;
+		}
+		end = gp_symbols[i].section_end;
+		for (j = i + 1; j < g_symbol_cnt; j++)
+		{
+			if(gp_symbols[j].addr > gp_symbols[i].addr)
+			{
+				if(end == 0 || gp_symbols[j].addr < end)
+				{
+					end = gp_symbols[j].addr;
+				}
+				break;
+			}
+		}
+		if(end > gp_symbols[i].addr)
+		{
+			gp_symbols[i].size = end - gp_symbols[i].addr;
+		}
+	}
+	return true;
+}
+
+//*****************************************************************************
+//
+//! @brief Find the function of a sampled PC.
+//!
+//! On the host, the PCs in shared libraries (libc, vdso) were cut to 32-bit
+//! offsets from the executable, so they land anywhere. The ones outside the
+//! code of the image are reported as such.
+//!
+//! @return Name of the function, g_outside if the PC is outside the code of
+//!         the image, NULL if it is in the code but outside all functions.
+//
+//*****************************************************************************
+static const char *find_function(uint32_t pc)
+{
+	uint64_t addr = g_pc_base + pc;
+	uint32_t low = 0, high = g_symbol_cnt, mid;
+	const struct symbol *p_sym;
+
+	if(addr < g_text_start || addr >= g_text_end)
+	{
+		return g_outside;
+	}
+
+	// last symbol at or below the address
+	while(high - low > 1)
+	{
+		mid = (low + high) / 2;
+		if(gp_symbols[mid].addr <= addr)
+		{
+			low = mid;
+		}
+		else
+		{
+			high = mid;
+		}
+	}
+	p_sym = &gp_symbols[low];
+	if(addr < p_sym->addr || addr >= p_sym->addr + p_sym->size)
+	{
+		return NULL;
+	}
+	return p_sym->p_name;
+}
+
+//*****************************************************************************
+//
+//! @brief Count the samples of a function within a task.
+//
+//*****************************************************************************
+static void add_hits(uint32_t task, const char *p_name, uint32_t pc,
+	uint32_t hits)
+{
+	uint32_t i;
+
+	for (i = 0; i < g_hot_cnt; i++)
+	{
+		if(gp_hots[i].task == task && (p_name ? gp_hots[i].p_name == p_name :
+			(gp_hots[i].p_name == NULL && gp_hots[i].pc == pc)))
+		{
+			gp_hots[i].hits += hits;
+			return;
+		}
+	}
+	gp_hots[g_hot_cnt].task = task;
+	gp_hots[g_hot_cnt].p_name = p_name;
+	gp_hots[g_hot_cnt].pc = pc;
+	gp_hots[g_hot_cnt].hits = hits;
+	g_hot_cnt++;
+}
+
+//*****************************************************************************
+//
+//! @brief Sort the hot spots by task, then by samples.
+//
+//*****************************************************************************
+static int compare_hots(const void *p_a, const void *p_b)
+{
+	const struct hot *p_ha = p_a, *p_hb = p_b;
+
+	if(p_ha->task != p_hb->task)
+	{
+		return p_ha->task < p_hb->task ? -1 : 1;
+	}
+	return (p_ha->hits < p_hb->hits) - (p_ha->hits > p_hb->hits);
+}
+
+//*****************************************************************************
+//
+//! @brief Load the dump and symbolize its slots.
+//!
+//! @return Number of samples in the slots, -1 on error.
+//
+//*****************************************************************************
+static long load_dump(const char *p_path)
+{
+	long size, total = 0;
+	uint8_t *p_dump;
+	const uint8_t *p_slot;
+	uint32_t i, slots, pc, task, hits;
+	const char *p_name;
+
+	p_dump = read_file(p_path, &size);
+	if(p_dump == NULL)
+	{
+		return -1;
+	}
+	if(size < HEADER_SIZE || read_u32(&p_dump[0]) != PROFILE_MAGIC)
+	{
+		fprintf(stderr, "%s: not a profile buffer dump\n", p_path);
+		free(p_dump);
+		return -1;
+	}
+	if(read_u16(&p_dump[4]) != PROFILE_VERSION)
+	{
+		fprintf(stderr, "%s: unsupported profile version %u\n", p_path,
+			read_u16(&p_dump[4]));
+		free(p_dump);
+		return -1;
+	}
+	slots = read_u16(&p_dump[6]);
+	if(size < HEADER_SIZE + (long)slots * SLOT_SIZE)
+	{
+		fprintf(stderr, "%s: truncated dump\n", p_path);
+		free(p_dump);
+		return -1;
+	}
+
+	printf("%u samples at %u Hz, %u dropped\n\n", read_u32(&p_dump[12]),
+		read_u32(&p_dump[8]), read_u32(&p_dump[16]));
+
+	gp_hots = calloc(2 * (size_t)slots + 1, sizeof(*gp_hots));
+	for (i = 0; i < slots; i++)
+	{
+		p_slot = &p_dump[HEADER_SIZE + i * SLOT_SIZE];
+		pc = read_u32(&p_slot[0]);
+		task = read_u16(&p_slot[4]) % MAX_TASKS;
+		hits = read_u32(&p_slot[8]);
+		if(hits == 0)
+		{
+			continue;
+		}
+		p_name = find_function(pc);
+		add_hits(task, p_name, pc, hits);
+		add_hits(TASK_ALL, p_name, pc, hits);
+		total += hits;
+	}
+	free(p_dump);
+
+	qsort(gp_hots, g_hot_cnt, sizeof(*gp_hots), compare_hots);
+	return total;
+}
+
+//*****************************************************************************
+//
+//! @brief Print the top functions of every task and of the whole system.
+//
+//*****************************************************************************
+static void print_hots(long total, uint32_t top)
+{
+	uint32_t i, j, task, task_total;
+	char pc[16];
+
+	for (i = 0; i < g_hot_cnt; i = j)
+	{
+		task = gp_hots[i].task;
+		task_total = 0;
+		for (j = i; j < g_hot_cnt && gp_hots[j].task == task; j++)
+		{
+			task_total += gp_hots[j].hits;
+		}
+
+		printf("%-12s %8u samples %6.2f%%\n", task == TASK_ALL ? "all" :
+			g_names[task], task_total, total ? 100.0 * task_total / total :
+			0.0);
+		for (j = i; j < g_hot_cnt && gp_hots[j].task == task; j++)
+		{
+			if(j - i < top)
+			{
+				snprintf(pc, sizeof(pc), "0x%08x", gp_hots[j].pc);
+				printf("    %6.2f%% %8u  %s\n", 100.0 * gp_hots[j].hits /
+					task_total, gp_hots[j].hits, gp_hots[j].p_name ?
+					gp_hots[j].p_name : pc);
+			}
+		}
+		printf("\n");
+	}
+}
+
+//*****************************************************************************
+//
+//! @brief Set the task names from a comma separated list.
+//
+//*****************************************************************************
+static void set_names(char *p_list)
+{
+	uint32_t i;
+	char *p_name;
+
+	for (i = 0; i < MAX_TASKS; i++)
+	{
+		snprintf(g_names[i], NAME_SIZE, "task%u", i);
+	}
+	for (i = 0, p_name = p_list ? strtok(p_list, ",") : NULL; p_name != NULL &&
+		i < MAX_TASKS; i++, p_name = strtok(NULL, ","))
+	{
+		snprintf(g_names[i], NAME_SIZE, "%s", p_name);
+	}
+}
+
+static void usage(const char *p_prog)
+{
+	fprintf(stderr, "usage: %s [-t name0,name1,...] [-n top] image.elf "
+		"dump.bin\n", p_prog);
+}
+
+//*****************************************************************************
+//
+//  Main.
+//
+//*****************************************************************************
+
+int main(int argc, char **argv)
+{
+	char *p_names = NULL;
+	uint32_t top = 10;
+	long total;
+	int opt;
+
+	while((opt = getopt(argc, argv, "t:n:h")) != -1)
+	{
+		switch(opt)
+		{
+			case 't': p_names = optarg; break;
+			case 'n': top = (uint32_t)strtoul(optarg, NULL, 0); break;
+			default: usage(argv[0]); return 1;
+		}
+	}
+	if(optind != argc - 2)
+	{
+		usage(argv[0]);
+		return 1;
+	}
+
+	set_names(p_names);
+	if(!load_image(argv[optind]))
+	{
+		return 1;
+	}
+	total = load_dump(argv[optind + 1]);
+	if(total < 0)
+	{
+		return 1;
+	}
+	print_hots(total, top);
+
+	free(gp_hots);
+	free(gp_symbols);
+	free(gp_image);
+	return 0;
+}
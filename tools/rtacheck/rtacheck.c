@@ -0,0 +1,222 @@
+//*****************************************************************************
+//
+//  Host-side schedulability check of a periodic task table.
+//  File: 		rtacheck.c
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//  Runs the analysis of the kernel admission control (rta.c) over a table
+//  of periodic tasks, one per line ('#' starts a comment):
+//
+//    name  period_ms  wcet_us  priority  [deadline_ms]
+//
+//  and prints the response time of every task under fixed priority, or the
+//  density of the set under EDF (-e). The exit status is 0 if the set is
+//  schedulable, 2 if not and 1 on errors.
+//
+//  Usage: rtacheck [-e] table.txt
+//
+//*****************************************************************************
+//*****************************************************************************
+//
+//  The following are header files for the C standard library.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+//*****************************************************************************
+//
+//  This is the kernel header file with the analysis.
+//
+//*****************************************************************************
+
+#include "rta.h"
+
+//*****************************************************************************
+//
+//  The following are defines for the checker.
+//
+//*****************************************************************************
+
+#define MAX_TASKS 			255			// sizes are 8 bits in rta.h
+#define NAME_SIZE 			32
+#define LINE_SIZE 			256
+
+//*****************************************************************************
+//
+//  The following are global definitions for the checker.
+//
+//*****************************************************************************
+
+static struct rta_task g_set[MAX_TASKS];
+static char g_names[MAX_TASKS][NAME_SIZE];
+static uint8_t g_task_cnt;
+
+//*****************************************************************************
+//
+//  Private Functions.
+//
+//*****************************************************************************
+//*****************************************************************************
+//
+//! @brief Read the task table.
+//!
+//! @param[in] p_path Path of the table, "-" for the standard input.
+//!
+//! @return True if successful.
+//
+//*****************************************************************************
+static bool load_table(const char *p_path)
+{
+	FILE *p_file;
+	char line[LINE_SIZE];
+	char name[NAME_SIZE];
+	unsigned long period, wcet, priority, deadline;
+	uint32_t line_cnt = 0;
+	char *p_hash;
+	int fields;
+
+	p_file = strcmp(p_path, "-") ? fopen(p_path, "r") : stdin;
+	if(p_file == NULL)
+	{
+		perror(p_path);
+		return false;
+	}
+
+	while(fgets(line, sizeof(line), p_file) != NULL)
+	{
+		line_cnt++;
+		p_hash = strchr(line, '#');
+		if(p_hash != NULL)
+		{
+			*p_hash = '\0';
+		}
+		deadline = 0;
+		fields = sscanf(line, "%31s %lu %lu %lu %lu", name, &period, &wcet,
+			&priority, &deadline);
+		if(fields <= 0)
+		{
+			continue;	// blank line
+		}
+		if(fields < 4 || period == 0 || period > UINT32_MAX / 1000 ||
+			wcet > UINT32_MAX || priority > 255 ||
+			deadline > UINT32_MAX / 1000)
+		{
+			fprintf(stderr, "%s:%u: expected name period_ms wcet_us "
+				"priority [deadline_ms]\n", p_path, line_cnt);
+			return false;
+		}
+		if(g_task_cnt == MAX_TASKS)
+		{
+			fprintf(stderr, "%s: more than %u tasks\n", p_path, MAX_TASKS);
+			return false;
+		}
+		snprintf(g_names[g_task_cnt], NAME_SIZE, "%s", name);
+		g_set[g_task_cnt].period = (uint32_t)period * 1000;
+		g_set[g_task_cnt].wcet = (uint32_t)wcet;
+		g_set[g_task_cnt].deadline = (uint32_t)deadline * 1000;
+		g_set[g_task_cnt].priority = (uint8_t)priority;
+		g_task_cnt++;
+	}
+
+	if(p_file != stdin)
+	{
+		fclose(p_file);
+	}
+	if(g_task_cnt == 0)
+	{
+		fprintf(stderr, "%s: no tasks\n", p_path);
+		return false;
+	}
+	return true;
+}
+
+//*****************************************************************************
+//
+//! @brief Print the analysis of the table.
+//!
+//! @param[in] edf True for EDF, false for fixed priority.
+//!
+//! @return True if the set is schedulable.
+//
+//*****************************************************************************
+static bool print_check(bool edf)
+{
+	uint32_t resp, util;
+	bool schedulable;
+	uint8_t i;
+
+	for (i = 0; i < g_task_cnt; i++)
+	{
+		printf("task=%s period_ms=%u wcet_us=%u prio=%u deadline_ms=%u",
+			g_names[i], g_set[i].period / 1000, g_set[i].wcet,
+			g_set[i].priority, (g_set[i].deadline ? g_set[i].deadline :
+			g_set[i].period) / 1000);
+		if(!edf)
+		{
+			resp = Rta_response_time(g_set, g_task_cnt, i);
+			if(resp == RTA_UNSCHEDULABLE)
+			{
+				printf(" response_us=miss");
+			}
+			else
+			{
+				printf(" response_us=%u", resp);
+			}
+		}
+		printf("\n");
+	}
+
+	schedulable = edf ? Rta_edf_check(g_set, g_task_cnt) :
+		Rta_fp_check(g_set, g_task_cnt);
+	util = Rta_utilization(g_set, g_task_cnt);
+	printf("policy=%s tasks=%u util=%u.%02u%% schedulable=%s\n",
+		edf ? "edf" : "fp", g_task_cnt, util / 10000, (util / 100) % 100,
+		schedulable ? "yes" : "no");
+
+	return schedulable;
+}
+
+static void usage(const char *p_prog)
+{
+	fprintf(stderr, "usage: %s [-e] table.txt\n", p_prog);
+}
+
+//*****************************************************************************
+//
+//  Main.
+//
+//*****************************************************************************
+
+int main(int argc, char **argv)
+{
+	bool edf = false;
+	int opt;
+
+	while((opt = getopt(argc, argv, "eh")) != -1)
+	{
+		switch(opt)
+		{
+			case 'e': edf = true; break;
+			default: usage(argv[0]); return 1;
+		}
+	}
+	if(optind != argc - 1)
+	{
+		usage(argv[0]);
+		return 1;
+	}
+
+	if(!load_table(argv[optind]))
+	{
+		return 1;
+	}
+	return print_check(edf) ? 0 : 2;
+}
@@ -0,0 +1,732 @@
+//*****************************************************************************
+//
+//  Host-side decoder for the kernel trace buffer.
+//  File: 		tracedecode.c
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//  Reads a raw memory dump of g_trace (see trace.h), rebuilds the state of
+//  every task and writes a Chrome trace-event JSON file that can be opened
+//  in chrome://tracing or https://ui.perfetto.dev. Per-task response-time
+//  statistics are printed on stdout.
+//
+//  Usage: tracedecode [-o trace.json] [-t name0,name1,...] [-r ram_base] dump
+//
+//*****************************************************************************
+//*****************************************************************************
+//
+//  The following are header files for the C standard library.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+//*****************************************************************************
+//
+//  This is the kernel header file with the record layout and event ids.
+//
+//*****************************************************************************
+
+#include "trace.h"
+
+//*****************************************************************************
+//
+//  The following are defines for the decoder.
+//
+//*****************************************************************************
+
+#define MAX_TASKS 			256			// task ids are 8 bits
+#define MAX_ISR_NESTING 	8
+#define NAME_SIZE 			32
+#define HEADER_SIZE 		16			// bytes before the first record
+#define RECORD_SIZE 		8			// bytes per record
+
+#define PID_CPU 			1			// running slices and ISRs
+#define PID_STATES 			2			// task states
+#define TID_ISR 			0
+
+//*****************************************************************************
+//
+//  The following are the task states rebuilt from the events.
+//
+//*****************************************************************************
+
+enum state
+{
+	STATE_UNKNOWN = 0,
+	STATE_READY,
+	STATE_BLOCKED,
+	STATE_SLEEPING
+};
+
+//*****************************************************************************
+//
+//  This data structure defines a decoded record.
+//
+//*****************************************************************************
+
+struct event
+{
+	int64_t ts;				// unwrapped cycle count
+	uint32_t seq;			// position in the buffer (sort tiebreak)
+	uint8_t type;
+	uint8_t task;
+	uint16_t object;
+};
+
+//*****************************************************************************
+//
+//  This data structure defines the rebuilt state and statistics of a task.
+//
+//*****************************************************************************
+
+struct task
+{
+	char name[NAME_SIZE];
+	bool seen;
+
+	enum state state;		// ready, blocked or sleeping
+	uint16_t object;		// semaphore or sleep ticks of the state
+	int64_t state_since;
+	bool on_cpu;			// running
+	int64_t run_since;
+
+	bool released;			// job released and not completed yet
+	bool dispatched;		// job released and switched in
+	int64_t release_ts;
+	bool flow_pending;		// semaphore hand-off waiting for switch in
+	uint32_t flow_id;
+
+	int64_t run_time;
+	uint32_t switches;
+	uint32_t jobs;
+	int64_t resp_min, resp_max, resp_sum;
+	uint32_t lat_cnt;
+	int64_t lat_min, lat_max, lat_sum;
+};
+
+//*****************************************************************************
+//
+//  This data structure defines the last post of a semaphore.
+//
+//*****************************************************************************
+
+struct post
+{
+	bool valid;
+	int64_t ts;
+	int tid;
+};
+
+//*****************************************************************************
+//
+//  The following are global definitions for the decoder.
+//
+//*****************************************************************************
+
+static struct task g_tasks[MAX_TASKS];
+static struct post g_posts[1 << 16];	// indexed by semaphore object
+static FILE *gp_json;
+static bool g_first_event = true;
+static double g_cycles_per_us;
+static uint32_t g_ram_base = 0x20000000;
+static uint32_t g_flow_cnt = 0;
+
+//*****************************************************************************
+//
+//  Private Functions.
+//
+//*****************************************************************************
+//*****************************************************************************
+//
+//! @brief Read little endian values from the dump.
+//
+//*****************************************************************************
+static uint32_t read_u32(const uint8_t *p)
+{
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+		((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t read_u16(const uint8_t *p)
+{
+	return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+//*****************************************************************************
+//
+//! @brief Convert cycles to microseconds.
+//
+//*****************************************************************************
+static double to_us(int64_t cycles)
+{
+	return (double)cycles / g_cycles_per_us;
+}
+
+//*****************************************************************************
+//
+//! @brief Sort events by timestamp, keeping the buffer order on ties.
+//
+//*****************************************************************************
+static int compare_events(const void *p_a, const void *p_b)
+{
+	const struct event *a = p_a;
+	const struct event *b = p_b;
+
+	if(a->ts != b->ts)
+	{
+		return a->ts < b->ts ? -1 : 1;
+	}
+	return a->seq < b->seq ? -1 : (a->seq > b->seq);
+}
+
+//*****************************************************************************
+//
+//! @brief Start a JSON event (handles the separator between events).
+//
+//*****************************************************************************
+static void json_begin(void)
+{
+	fputs(g_first_event ? "\n" : ",\n", gp_json);
+	g_first_event = false;
+}
+
+static void json_name(int pid, int tid, const char *meta, const char *name)
+{
+	json_begin();
+	fprintf(gp_json, "{\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"name\":\"%s\","
+		"\"args\":{\"name\":\"%s\"}}", pid, tid, meta, name);
+}
+
+static void json_slice(int pid, int tid, const char *name, int64_t start,
+	int64_t end)
+{
+	json_begin();
+	fprintf(gp_json, "{\"ph\":\"X\",\"pid\":%d,\"tid\":%d,\"name\":\"%s\","
+		"\"ts\":%.3f,\"dur\":%.3f}", pid, tid, name, to_us(start),
+		to_us(end - start));
+}
+
+static void json_instant(int tid, const char *name, uint16_t object,
+	int64_t ts)
+{
+	json_begin();
+	fprintf(gp_json, "{\"ph\":\"i\",\"s\":\"t\",\"pid\":%d,\"tid\":%d,"
+		"\"name\":\"%s\",\"ts\":%.3f,\"args\":{\"sema\":\"0x%08X\"}}",
+		PID_CPU, tid, name, to_us(ts), g_ram_base | object);
+}
+
+static void json_flow(char phase, uint32_t id, int tid, int64_t ts)
+{
+	json_begin();
+	fprintf(gp_json, "{\"ph\":\"%c\",\"id\":%u,\"pid\":%d,\"tid\":%d,"
+		"\"name\":\"handoff\",\"cat\":\"sema\",\"ts\":%.3f%s}", phase, id,
+		PID_CPU, tid, to_us(ts), phase == 'f' ? ",\"bp\":\"e\"" : "");
+}
+
+//*****************************************************************************
+//
+//! @brief Close the current state slice of a task and open a new one.
+//
+//*****************************************************************************
+static void set_state(uint8_t id, enum state state, uint16_t object,
+	int64_t ts)
+{
+	struct task *p_task = &g_tasks[id];
+	char name[64];
+
+	if(p_task->state == STATE_READY)
+	{
+		json_slice(PID_STATES, id + 1, "ready", p_task->state_since, ts);
+	}
+	else if(p_task->state == STATE_BLOCKED)
+	{
+		snprintf(name, sizeof(name), "blocked on 0x%08X",
+			g_ram_base | p_task->object);
+		json_slice(PID_STATES, id + 1, name, p_task->state_since, ts);
+	}
+	else if(p_task->state == STATE_SLEEPING)
+	{
+		snprintf(name, sizeof(name), "sleeping (%u ticks)", p_task->object);
+		json_slice(PID_STATES, id + 1, name, p_task->state_since, ts);
+	}
+
+	p_task->seen = true;
+	p_task->state = state;
+	p_task->object = object;
+	p_task->state_since = ts;
+}
+
+//*****************************************************************************
+//
+//! @brief Switch a task in or out of the CPU.
+//
+//*****************************************************************************
+static void run_in(uint8_t id, int64_t ts)
+{
+	struct task *p_task = &g_tasks[id];
+
+	p_task->seen = true;
+	p_task->on_cpu = true;
+	p_task->run_since = ts;
+	p_task->switches++;
+
+	// first dispatch of the job (latency from the release)
+	if(p_task->released && !p_task->dispatched)
+	{
+		int64_t lat = ts - p_task->release_ts;
+
+		p_task->dispatched = true;
+		if(p_task->lat_cnt == 0 || lat < p_task->lat_min)
+		{
+			p_task->lat_min = lat;
+		}
+		if(p_task->lat_cnt == 0 || lat > p_task->lat_max)
+		{
+			p_task->lat_max = lat;
+		}
+		p_task->lat_sum += lat;
+		p_task->lat_cnt++;
+	}
+	if(p_task->flow_pending)
+	{
+		json_flow('f', p_task->flow_id, id + 1, ts);
+		p_task->flow_pending = false;
+	}
+}
+
+static void run_out(uint8_t id, int64_t ts)
+{
+	struct task *p_task = &g_tasks[id];
+
+	if(p_task->on_cpu)
+	{
+		json_slice(PID_CPU, id + 1, "running", p_task->run_since, ts);
+		p_task->run_time += ts - p_task->run_since;
+		p_task->on_cpu = false;
+	}
+}
+
+//*****************************************************************************
+//
+//! @brief Release and completion of the jobs of a task.
+//
+//*****************************************************************************
+static void job_release(uint8_t id, int64_t ts)
+{
+	struct task *p_task = &g_tasks[id];
+
+	p_task->released = true;
+	p_task->dispatched = p_task->on_cpu;
+	p_task->release_ts = ts;
+}
+
+static void job_complete(uint8_t id, int64_t ts)
+{
+	struct task *p_task = &g_tasks[id];
+	int64_t resp;
+
+	if(!p_task->released)
+	{
+		return;
+	}
+
+	resp = ts - p_task->release_ts;
+	if(p_task->jobs == 0 || resp < p_task->resp_min)
+	{
+		p_task->resp_min = resp;
+	}
+	if(p_task->jobs == 0 || resp > p_task->resp_max)
+	{
+		p_task->resp_max = resp;
+	}
+	p_task->resp_sum += resp;
+	p_task->jobs++;
+	p_task->released = false;
+}
+
+//*****************************************************************************
+//
+//! @brief Load the dump and return the events in chronological order.
+//
+//*****************************************************************************
+static struct event *load_dump(const char *p_path, uint32_t *p_cnt,
+	uint32_t *p_clock)
+{
+	FILE *p_file;
+	uint8_t header[HEADER_SIZE];
+	uint8_t *p_raw;
+	struct event *p_events;
+	uint32_t i, size, head, first, cnt, prev;
+	int64_t ts, min;
+
+	p_file = fopen(p_path, "rb");
+	if(p_file == NULL)
+	{
+		perror(p_path);
+		return NULL;
+	}
+
+	if(fread(header, 1, HEADER_SIZE, p_file) != HEADER_SIZE ||
+		read_u32(&header[0]) != TRACE_MAGIC)
+	{
+		fprintf(stderr, "%s: not a trace buffer dump\n", p_path);
+		fclose(p_file);
+		return NULL;
+	}
+	if(read_u16(&header[4]) != TRACE_VERSION)
+	{
+		fprintf(stderr, "%s: unsupported trace version %u\n", p_path,
+			read_u16(&header[4]));
+		fclose(p_file);
+		return NULL;
+	}
+
+	size = read_u16(&header[6]);
+	*p_clock = read_u32(&header[8]);
+	head = read_u32(&header[12]);
+	if(size == 0 || (size & (size - 1)) != 0 || *p_clock == 0)
+	{
+		fprintf(stderr, "%s: corrupted header\n", p_path);
+		fclose(p_file);
+		return NULL;
+	}
+
+	p_raw = malloc((size_t)size * RECORD_SIZE);
+	p_events = malloc((size_t)size * sizeof(struct event));
+	if(p_raw == NULL || p_events == NULL ||
+		fread(p_raw, RECORD_SIZE, size, p_file) != size)
+	{
+		fprintf(stderr, "%s: truncated dump\n", p_path);
+		free(p_raw);
+		free(p_events);
+		fclose(p_file);
+		return NULL;
+	}
+	fclose(p_file);
+
+	// oldest record first
+	cnt = head < size ? head : size;
+	first = head < size ? 0 : head;
+
+	// unwrap the 32-bit timestamps (records may be slightly out of order
+	// when an ISR preempts a writer, hence the signed difference)
+	ts = 0;
+	min = 0;
+	prev = 0;
+	for (i = 0; i < cnt; i++)
+	{
+		const uint8_t *p_rec = &p_raw[((first + i) & (size - 1)) * RECORD_SIZE];
+		uint32_t stamp = read_u32(&p_rec[0]);
+
+		if(i > 0)
+		{
+			ts += (int32_t)(stamp - prev);
+		}
+		prev = stamp;
+		min = ts < min ? ts : min;
+
+		p_events[i].ts = ts;
+		p_events[i].seq = i;
+		p_events[i].type = p_rec[4];
+		p_events[i].task = p_rec[5];
+		p_events[i].object = read_u16(&p_rec[6]);
+	}
+	for (i = 0; i < cnt; i++)
+	{
+		p_events[i].ts -= min;
+	}
+	qsort(p_events, cnt, sizeof(struct event), compare_events);
+
+	free(p_raw);
+	*p_cnt = cnt;
+	return p_events;
+}
+
+//*****************************************************************************
+//
+//! @brief Replay the events and write the timeline.
+//
+//*****************************************************************************
+static void decode(const struct event *p_events, uint32_t cnt)
+{
+	uint32_t i;
+	int cur = -1;							// running task (-1 unknown)
+	int isr_depth = 0;
+	int64_t isr_start[MAX_ISR_NESTING];
+	int64_t end = cnt ? p_events[cnt - 1].ts : 0;
+
+	for (i = 0; i < cnt; i++)
+	{
+		const struct event *p_ev = &p_events[i];
+		int tid;
+
+		// the first event of the running task tells who had the CPU
+		if(cur < 0 && p_ev->type != TRACE_SWITCH &&
+			p_ev->type != TRACE_UNBLOCK && p_ev->type != TRACE_WAKE)
+		{
+			cur = p_ev->task;
+			run_in(p_ev->task, 0);
+			if(g_tasks[cur].state == STATE_UNKNOWN)
+			{
+				set_state(p_ev->task, STATE_READY, 0, 0);
+			}
+		}
+		tid = isr_depth > 0 ? TID_ISR : (cur < 0 ? TID_ISR : cur + 1);
+
+		switch(p_ev->type)
+		{
+			case TRACE_SWITCH:
+				if(p_ev->object >= MAX_TASKS)
+				{
+					// the id of the task switched out is 8 bits
+					fprintf(stderr, "bad task %u at record %u\n",
+						p_ev->object, p_ev->seq);
+					break;
+				}
+				if(cur < 0)
+				{
+					g_tasks[p_ev->object].on_cpu = true;
+					g_tasks[p_ev->object].run_since = 0;
+				}
+				run_out((uint8_t)p_ev->object, p_ev->ts);
+				if(g_tasks[p_ev->object].state == STATE_UNKNOWN)
+				{
+					set_state((uint8_t)p_ev->object, STATE_READY, 0, 0);
+				}
+				if(g_tasks[p_ev->task].state == STATE_UNKNOWN)
+				{
+					set_state(p_ev->task, STATE_READY, 0, p_ev->ts);
+				}
+				run_in(p_ev->task, p_ev->ts);
+				cur = p_ev->task;
+				break;
+
+			case TRACE_PEND:
+				json_instant(tid, "pend", p_ev->object, p_ev->ts);
+				break;
+
+			case TRACE_BLOCK:
+				job_complete(p_ev->task, p_ev->ts);
+				set_state(p_ev->task, STATE_BLOCKED, p_ev->object, p_ev->ts);
+				break;
+
+			case TRACE_POST:
+				json_instant(tid, "post", p_ev->object, p_ev->ts);
+				g_posts[p_ev->object].valid = true;
+				g_posts[p_ev->object].ts = p_ev->ts;
+				g_posts[p_ev->object].tid = tid;
+				break;
+
+			case TRACE_UNBLOCK:
+				if(g_posts[p_ev->object].valid)
+				{
+					// semaphore hand-off from the poster to the woken task
+					json_flow('s', ++g_flow_cnt, g_posts[p_ev->object].tid,
+						g_posts[p_ev->object].ts);
+					g_tasks[p_ev->task].flow_pending = true;
+					g_tasks[p_ev->task].flow_id = g_flow_cnt;
+					g_posts[p_ev->object].valid = false;
+				}
+				set_state(p_ev->task, STATE_READY, 0, p_ev->ts);
+				job_release(p_ev->task, p_ev->ts);
+				break;
+
+			case TRACE_SLEEP:
+				job_complete(p_ev->task, p_ev->ts);
+				set_state(p_ev->task, STATE_SLEEPING, p_ev->object, p_ev->ts);
+				break;
+
+			case TRACE_WAKE:
+				set_state(p_ev->task, STATE_READY, 0, p_ev->ts);
+				job_release(p_ev->task, p_ev->ts);
+				break;
+
+			case TRACE_ISR_ENTER:
+				if(isr_depth < MAX_ISR_NESTING)
+				{
+					isr_start[isr_depth] = p_ev->ts;
+				}
+				isr_depth++;
+				break;
+
+			case TRACE_ISR_EXIT:
+				if(isr_depth > 0)
+				{
+					isr_depth--;
+					if(isr_depth < MAX_ISR_NESTING)
+					{
+						json_slice(PID_CPU, TID_ISR, p_ev->object ==
+							TRACE_ISR_EVENTS ? "WideTimer5A" : p_ev->object ==
+							TRACE_ISR_HRTIMER ? "WideTimer3A" : "ISR",
+							isr_start[isr_depth], p_ev->ts);
+					}
+				}
+				break;
+
+			default:
+				fprintf(stderr, "unknown event %u at record %u\n",
+					p_ev->type, p_ev->seq);
+				break;
+		}
+	}
+
+	// close the open slices at the end of the trace
+	for (i = 0; i < MAX_TASKS; i++)
+	{
+		if(g_tasks[i].seen)
+		{
+			run_out((uint8_t)i, end);
+			set_state((uint8_t)i, STATE_UNKNOWN, 0, end);
+		}
+	}
+}
+
+//*****************************************************************************
+//
+//! @brief Print the per-task statistics.
+//
+//*****************************************************************************
+static void print_stats(int64_t duration)
+{
+	uint32_t i;
+
+	printf("trace duration: %.3f ms\n\n", to_us(duration) / 1000.0);
+	printf("%-12s %6s %8s %6s %30s %30s\n", "task", "cpu%", "switches",
+		"jobs", "response min/avg/max (us)", "latency min/avg/max (us)");
+
+	for (i = 0; i < MAX_TASKS; i++)
+	{
+		const struct task *p_task = &g_tasks[i];
+		char resp[40] = "-";
+		char lat[40] = "-";
+
+		if(!p_task->seen)
+		{
+			continue;
+		}
+		if(p_task->jobs)
+		{
+			snprintf(resp, sizeof(resp), "%.1f/%.1f/%.1f",
+				to_us(p_task->resp_min),
+				to_us(p_task->resp_sum) / p_task->jobs,
+				to_us(p_task->resp_max));
+		}
+		if(p_task->lat_cnt)
+		{
+			snprintf(lat, sizeof(lat), "%.1f/%.1f/%.1f",
+				to_us(p_task->lat_min),
+				to_us(p_task->lat_sum) / p_task->lat_cnt,
+				to_us(p_task->lat_max));
+		}
+		printf("%-12s %6.2f %8u %6u %30s %30s\n", p_task->name,
+			duration ? 100.0 * p_task->run_time / duration : 0.0,
+			p_task->switches, p_task->jobs, resp, lat);
+	}
+}
+
+//*****************************************************************************
+//
+//! @brief Set the task names from a comma separated list.
+//
+//*****************************************************************************
+static void set_names(char *p_list)
+{
+	uint32_t i;
+	char *p_name;
+
+	for (i = 0; i < MAX_TASKS; i++)
+	{
+		snprintf(g_tasks[i].name, NAME_SIZE, "task%u", i);
+	}
+	if(p_list == NULL)
+	{
+		return;
+	}
+	for (i = 0, p_name = strtok(p_list, ","); p_name != NULL &&
+		i < MAX_TASKS; i++, p_name = strtok(NULL, ","))
+	{
+		snprintf(g_tasks[i].name, NAME_SIZE, "%s", p_name);
+	}
+}
+
+static void usage(const char *p_prog)
+{
+	fprintf(stderr, "usage: %s [-o trace.json] [-t name0,name1,...] "
+		"[-r ram_base] dump.bin\n", p_prog);
+}
+
+//*****************************************************************************
+//
+//  Main.
+//
+//*****************************************************************************
+
+int main(int argc, char **argv)
+{
+	const char *p_out = "trace.json";
+	char *p_names = NULL;
+	struct event *p_events;
+	uint32_t i, cnt, clock;
+	int opt;
+
+	while((opt = getopt(argc, argv, "o:t:r:h")) != -1)
+	{
+		switch(opt)
+		{
+			case 'o': p_out = optarg; break;
+			case 't': p_names = optarg; break;
+			case 'r': g_ram_base = (uint32_t)strtoul(optarg, NULL, 0); break;
+			default: usage(argv[0]); return 1;
+		}
+	}
+	if(optind != argc - 1)
+	{
+		usage(argv[0]);
+		return 1;
+	}
+
+	set_names(p_names);
+	p_events = load_dump(argv[optind], &cnt, &clock);
+	if(p_events == NULL)
+	{
+		return 1;
+	}
+	g_cycles_per_us = clock / 1e6;
+
+	gp_json = fopen(p_out, "w");
+	if(gp_json == NULL)
+	{
+		perror(p_out);
+		free(p_events);
+		return 1;
+	}
+
+	fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", gp_json);
+	json_name(PID_CPU, 0, "process_name", "CPU");
+	json_name(PID_CPU, TID_ISR, "thread_name", "ISR");
+	json_name(PID_STATES, 0, "process_name", "Task states");
+	decode(p_events, cnt);
+	for (i = 0; i < MAX_TASKS; i++)
+	{
+		if(g_tasks[i].seen)
+		{
+			json_name(PID_CPU, i + 1, "thread_name", g_tasks[i].name);
+			json_name(PID_STATES, i + 1, "thread_name", g_tasks[i].name);
+		}
+	}
+	fputs("\n]}\n", gp_json);
+	fclose(gp_json);
+
+	printf("%u records, %s written\n", cnt, p_out);
+	print_stats(cnt ? p_events[cnt - 1].ts : 0);
+
+	free(p_events);
+	return 0;
+}
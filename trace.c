@@ -0,0 +1,94 @@
+//*****************************************************************************
+//
+//  Binary trace recorder for the OS kernel.
+//  File: 		trace.c
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//*****************************************************************************
+//*****************************************************************************
+//
+//  The following are header files for the C standard library.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+
+//*****************************************************************************
+//
+//  This is the application header file.
+//
+//*****************************************************************************
+
+#include "trace.h"
+
+//*****************************************************************************
+//
+//  The following are header files for the TM4C123G driver library.
+//
+//*****************************************************************************
+
+#include "dwt.h"
+
+#if OS_CFG_TRACE
+
+#if (OS_CFG_TRACE_SIZE & TRACE_MASK) != 0
+#error "OS_CFG_TRACE_SIZE must be a power of two"
+#endif
+
+//*****************************************************************************
+//
+//  The following is the global definition of the trace buffer. It is found
+//  by the debugger through its symbol, so it must not be static.
+//
+//*****************************************************************************
+
+struct trace_buffer g_trace = 
+{
+	.magic = TRACE_MAGIC,
+	.version = TRACE_VERSION,
+	.size = OS_CFG_TRACE_SIZE,
+	.clock = CPU_CLOCK_FREQ,
+	.head = 0
+};
+
+//*****************************************************************************
+//
+//! @brief Write a record into the trace buffer.
+//!
+//! This function claims the next slot of the ring buffer with an exclusive 
+//! increment of the head, so it can be called from tasks and ISRs without 
+//! disabling interrupts. An ISR that preempts a writer gets its own slot. 
+//! The cost is about 20 cycles per record.
+//!
+//! @param[in] event One of the TRACE_xxx events.
+//! @param[in] task Index of the task related to the event.
+//! @param[in] object Event specific value (only the lower 16 bits are kept).
+//!
+//! @return None.
+//
+//*****************************************************************************
+void Trace_record(uint8_t event, uint8_t task, uint32_t object)
+{
+	uint32_t idx;
+	struct trace_record *p_rec;
+
+	// claim a slot
+#if defined(__GNUC__)
+	idx = __atomic_fetch_add(&g_trace.head, 1, __ATOMIC_RELAXED);
+#else	// Keil uVision and Code Composer Studio
+	do
+	{
+		idx = __ldrex(&g_trace.head);
+	} while(__strex(idx + 1, &g_trace.head));
+#endif
+
+	p_rec = &g_trace.records[idx & TRACE_MASK];
+	p_rec->timestamp = DWT_get_cycles();
+	p_rec->event = event;
+	p_rec->task = task;
+	p_rec->object = (uint16_t)object;
+}
+
+#endif	// OS_CFG_TRACE
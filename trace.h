@@ -0,0 +1,91 @@
+//*****************************************************************************
+//
+//  Prototypes and data structures for the kernel trace recorder.
+//  File: 		trace.h
+//  Version: 	1.0v
+//  Author: 	Ronald Rodriguez Ruiz.
+//  Date: 		October 18, 2026.
+//
+//*****************************************************************************
+
+#ifndef __TRACE_H__
+#define __TRACE_H__
+
+#include "os_config.h"
+
+//*****************************************************************************
+//
+//  The following are defines for the trace buffer layout. The buffer is 
+//  dumped as raw memory and decoded on the host, so the layout must not 
+//  change without bumping TRACE_VERSION.
+//
+//*****************************************************************************
+
+#define TRACE_MAGIC 		0x45435254	// "TRCE" in little endian
+#define TRACE_VERSION 		1
+#define TRACE_MASK 			(OS_CFG_TRACE_SIZE - 1)
+
+//*****************************************************************************
+//
+//  The following are defines for the recorded events.
+//
+//*****************************************************************************
+
+#define TRACE_SWITCH 		1			// task switched in, object = old task
+#define TRACE_PEND 			2			// semaphore taken, object = semaphore
+#define TRACE_BLOCK 		3			// blocked on semaphore, object = sema
+#define TRACE_POST 			4			// semaphore signaled, object = sema
+#define TRACE_UNBLOCK 		5			// task unblocked, object = semaphore
+#define TRACE_SLEEP 		6			// task sleeps, object = ticks
+#define TRACE_WAKE 			7			// sleep time elapsed
+#define TRACE_ISR_ENTER 	8			// object = ISR id
+#define TRACE_ISR_EXIT 		9			// object = ISR id
+
+#define TRACE_ISR_EVENTS 	0			// id of WideTimer5A_Handler
+#define TRACE_ISR_HRTIMER 	1			// id of WideTimer3A_Handler
+
+//*****************************************************************************
+//
+//  This data structure defines a trace record (8 bytes). Semaphores are 
+//  identified by the lower 16 bits of their address, which is unique within 
+//  the 32 KB SRAM of the TM4C123 (0x20000000-0x20007FFF).
+//
+//*****************************************************************************
+
+struct trace_record
+{
+	uint32_t timestamp;		// DWT cycle count
+	uint8_t event;			// one of the TRACE_xxx events
+	uint8_t task;			// index of the task in the order it was added
+	uint16_t object;		// event specific
+};
+
+//*****************************************************************************
+//
+//  This data structure defines the trace buffer. The head is a free-running 
+//  count of the records written, so the oldest record is at (head & MASK) 
+//  once the buffer has wrapped.
+//
+//*****************************************************************************
+
+struct trace_buffer
+{
+	uint32_t magic;			// TRACE_MAGIC
+	uint16_t version;		// TRACE_VERSION
+	uint16_t size;			// number of records (power of two)
+	uint32_t clock;			// timestamp frequency (Hz)
+	volatile uint32_t head;	// number of records written
+	struct trace_record records[OS_CFG_TRACE_SIZE];
+};
+
+//*****************************************************************************
+//
+//  Prototypes for the API
+//
+//*****************************************************************************
+
+extern struct trace_buffer g_trace;
+
+extern void Trace_record(uint8_t event, uint8_t task, uint32_t object);
+
+#endif	// __TRACE_H__